@@ -0,0 +1,141 @@
+/*
+ * Measures the throughput of head insertion and removal from 1 to 64 threads, comparing the lock-free
+ * `ConcurrentSinglyLinkedList` against a list of `Node` guarded by a single global mutex.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/concurrent_singly_linked_list_benchmark.c src/concurrent_singly_linked_list.c \
+ *     src/hazard_pointer.c src/singly_linked_list.c src/node_pool.c src/hash_index.c src/skip_list_index.c \
+ *     src/singly_linked_list_compaction.c src/singly_linked_list_status.c -o concurrent_singly_linked_list_benchmark
+ *   ./concurrent_singly_linked_list_benchmark [operations_per_thread]
+ *
+ * Every thread performs the given number of insert/remove pairs (1M by default).
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/concurrent_singly_linked_list.h"
+
+typedef struct BenchmarkContext
+{
+  ConcurrentSinglyLinkedList *concurrent_singly_linked_list;
+  pthread_mutex_t global_mutex;
+  Node *locked_head_node;
+  size_t operations_per_thread;
+} BenchmarkContext;
+
+static int benchmark_value = 1;
+
+static void free_nothing(NodeData node_data)
+{
+  (void)node_data;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void *run_lock_free_thread(void *argument)
+{
+  BenchmarkContext *benchmark_context = (BenchmarkContext *)argument;
+  HazardPointerRecord *hazard_pointer_record = register_concurrent_singly_linked_list_thread(benchmark_context->concurrent_singly_linked_list);
+
+  for (size_t operation = 0; operation < benchmark_context->operations_per_thread; operation++)
+  {
+    insert_node_at_concurrent_head(benchmark_context->concurrent_singly_linked_list, &benchmark_value);
+    pop_node_from_concurrent_head(benchmark_context->concurrent_singly_linked_list, hazard_pointer_record);
+  }
+
+  unregister_concurrent_singly_linked_list_thread(hazard_pointer_record);
+
+  return NULL;
+}
+
+static void *run_global_lock_thread(void *argument)
+{
+  BenchmarkContext *benchmark_context = (BenchmarkContext *)argument;
+
+  for (size_t operation = 0; operation < benchmark_context->operations_per_thread; operation++)
+  {
+    Node *new_node = create_node(&benchmark_value);
+
+    pthread_mutex_lock(&benchmark_context->global_mutex);
+
+    new_node->next_node = benchmark_context->locked_head_node;
+    benchmark_context->locked_head_node = new_node;
+
+    pthread_mutex_unlock(&benchmark_context->global_mutex);
+
+    pthread_mutex_lock(&benchmark_context->global_mutex);
+
+    Node *head_node = benchmark_context->locked_head_node;
+
+    benchmark_context->locked_head_node = head_node->next_node;
+
+    pthread_mutex_unlock(&benchmark_context->global_mutex);
+
+    free(head_node);
+  }
+
+  return NULL;
+}
+
+static double run_threads(void *(*thread_function)(void *), BenchmarkContext *benchmark_context, int thread_count)
+{
+  pthread_t threads[64];
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_create(&threads[thread_index], NULL, thread_function, benchmark_context);
+  }
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_join(threads[thread_index], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  return get_elapsed_seconds(start_time, end_time);
+}
+
+int main(int argc, char *argv[])
+{
+  BenchmarkContext benchmark_context;
+
+  benchmark_context.operations_per_thread = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+  benchmark_context.locked_head_node = NULL;
+
+  pthread_mutex_init(&benchmark_context.global_mutex, NULL);
+
+  printf("threads  lock-free Mops/s  global mutex Mops/s\n");
+
+  for (int thread_count = 1; thread_count <= 64; thread_count *= 2)
+  {
+    double operation_count = 2.0 * (double)benchmark_context.operations_per_thread * thread_count;
+
+    benchmark_context.concurrent_singly_linked_list = create_concurrent_singly_linked_list(free_nothing);
+
+    double lock_free_seconds = run_threads(run_lock_free_thread, &benchmark_context, thread_count);
+
+    free_concurrent_singly_linked_list(benchmark_context.concurrent_singly_linked_list);
+    free(benchmark_context.concurrent_singly_linked_list);
+
+    double global_lock_seconds = run_threads(run_global_lock_thread, &benchmark_context, thread_count);
+
+    printf("%7d  %16.2f  %19.2f\n", thread_count, operation_count / lock_free_seconds / 1e6, operation_count / global_lock_seconds / 1e6);
+  }
+
+  pthread_mutex_destroy(&benchmark_context.global_mutex);
+
+  return 0;
+}
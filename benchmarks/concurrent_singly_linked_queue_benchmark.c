@@ -0,0 +1,129 @@
+/*
+ * Measures the throughput of the lock-free `ConcurrentSinglyLinkedQueue` with the same number of producer
+ * and consumer threads, and checks that every enqueued value is dequeued exactly once.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/concurrent_singly_linked_queue_benchmark.c src/concurrent_singly_linked_queue.c \
+ *     src/hazard_pointer.c src/singly_linked_list_status.c -o concurrent_singly_linked_queue_benchmark
+ *   ./concurrent_singly_linked_queue_benchmark [operations_per_producer]
+ *
+ * Every producer enqueues the given number of values (1M by default).
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/concurrent_singly_linked_queue.h"
+
+typedef struct BenchmarkContext
+{
+  ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue;
+  size_t operations_per_producer;
+  atomic_size_t remaining_values;
+  atomic_uint_fast64_t dequeued_sum;
+} BenchmarkContext;
+
+static void free_nothing(NodeData node_data)
+{
+  (void)node_data;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void *run_producer_thread(void *argument)
+{
+  BenchmarkContext *benchmark_context = (BenchmarkContext *)argument;
+  HazardPointerRecord *hazard_pointer_record = register_concurrent_singly_linked_queue_thread(benchmark_context->concurrent_singly_linked_queue);
+
+  for (size_t operation = 1; operation <= benchmark_context->operations_per_producer; operation++)
+  {
+    enqueue_node_data(benchmark_context->concurrent_singly_linked_queue, hazard_pointer_record, (NodeData)(uintptr_t)operation);
+  }
+
+  unregister_concurrent_singly_linked_queue_thread(hazard_pointer_record);
+
+  return NULL;
+}
+
+static void *run_consumer_thread(void *argument)
+{
+  BenchmarkContext *benchmark_context = (BenchmarkContext *)argument;
+  HazardPointerRecord *hazard_pointer_record = register_concurrent_singly_linked_queue_thread(benchmark_context->concurrent_singly_linked_queue);
+  uint_fast64_t local_sum = 0;
+
+  while (atomic_load_explicit(&benchmark_context->remaining_values, memory_order_relaxed) > 0)
+  {
+    NodeData node_data = dequeue_node_data(benchmark_context->concurrent_singly_linked_queue, hazard_pointer_record);
+
+    if (node_data != NULL)
+    {
+      local_sum += (uintptr_t)node_data;
+
+      atomic_fetch_sub_explicit(&benchmark_context->remaining_values, 1, memory_order_relaxed);
+    }
+  }
+
+  atomic_fetch_add_explicit(&benchmark_context->dequeued_sum, local_sum, memory_order_relaxed);
+
+  unregister_concurrent_singly_linked_queue_thread(hazard_pointer_record);
+
+  return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+  BenchmarkContext benchmark_context;
+
+  benchmark_context.operations_per_producer = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+
+  printf("producers/consumers  Mops/s  checksum\n");
+
+  for (int thread_count = 1; thread_count <= 32; thread_count *= 2)
+  {
+    pthread_t threads[64];
+    struct timespec start_time;
+    struct timespec end_time;
+    uint_fast64_t operations = benchmark_context.operations_per_producer;
+
+    benchmark_context.concurrent_singly_linked_queue = create_concurrent_singly_linked_queue(free_nothing);
+
+    atomic_init(&benchmark_context.remaining_values, operations * thread_count);
+    atomic_init(&benchmark_context.dequeued_sum, 0);
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    for (int thread_index = 0; thread_index < thread_count; thread_index++)
+    {
+      pthread_create(&threads[2 * thread_index], NULL, run_producer_thread, &benchmark_context);
+      pthread_create(&threads[2 * thread_index + 1], NULL, run_consumer_thread, &benchmark_context);
+    }
+
+    for (int thread_index = 0; thread_index < 2 * thread_count; thread_index++)
+    {
+      pthread_join(threads[thread_index], NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+    uint_fast64_t expected_sum = operations * (operations + 1) / 2 * thread_count;
+    double seconds = get_elapsed_seconds(start_time, end_time);
+
+    printf("%19d  %6.2f  %s\n",
+           thread_count,
+           2.0 * (double)operations * thread_count / seconds / 1e6,
+           atomic_load(&benchmark_context.dequeued_sum) == expected_sum ? "ok" : "MISMATCH");
+
+    free_concurrent_singly_linked_queue(benchmark_context.concurrent_singly_linked_queue);
+    free(benchmark_context.concurrent_singly_linked_queue);
+  }
+
+  return 0;
+}
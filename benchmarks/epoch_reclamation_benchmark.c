@@ -0,0 +1,299 @@
+/*
+ * Measures the throughput of lock-free lookups over a shared chain of nodes from 1 to 64 reader threads while a
+ * writer thread keeps replacing its first node, comparing readers protected by an epoch critical section per
+ * lookup against readers publishing a hazard pointer for every node they visit.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/epoch_reclamation_benchmark.c src/epoch_reclamation.c src/hazard_pointer.c \
+ *     src/singly_linked_list_status.c -o epoch_reclamation_benchmark
+ *   ./epoch_reclamation_benchmark [lookups_per_thread] [chain_length]
+ *
+ * Every reader performs the given number of lookups (10K by default) of a key that is not stored, so every lookup
+ * visits the whole chain (1000 nodes by default). The writer retires every node it replaces, and the last column
+ * reports how many of them were still awaiting reclamation when the readers finished.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/epoch_reclamation.h"
+#include "../include/hazard_pointer.h"
+
+typedef struct ChainNode
+{
+  int64_t key;
+  struct ChainNode *next_node;
+} ChainNode;
+
+typedef struct BenchmarkContext
+{
+  _Atomic(ChainNode *) head_node;
+  EpochDomain epoch_domain;
+  HazardPointerDomain hazard_pointer_domain;
+  atomic_bool is_writer_running;
+  bool uses_epochs;
+  size_t lookups_per_thread;
+  size_t replaced_count;
+} BenchmarkContext;
+
+static BenchmarkContext benchmark_context;
+static atomic_size_t reclaimed_count;
+
+static void reclaim_chain_node(void *chain_node)
+{
+  atomic_fetch_add_explicit(&reclaimed_count, 1, memory_order_relaxed);
+
+  free(chain_node);
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static bool find_key_in_chain(ChainNode *chain_node, int64_t key)
+{
+  for (; chain_node != NULL; chain_node = chain_node->next_node)
+  {
+    if (chain_node->key == key)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void *run_epoch_reader_thread(void *argument)
+{
+  (void)argument;
+
+  EpochRecord *epoch_record = acquire_epoch_record(&benchmark_context.epoch_domain);
+
+  for (size_t lookup = 0; lookup < benchmark_context.lookups_per_thread; lookup++)
+  {
+    enter_epoch_critical_section(&benchmark_context.epoch_domain, epoch_record);
+
+    if (find_key_in_chain(atomic_load_explicit(&benchmark_context.head_node, memory_order_acquire), -1))
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+
+    exit_epoch_critical_section(epoch_record);
+  }
+
+  release_epoch_record(epoch_record);
+
+  return NULL;
+}
+
+static void *run_hazard_pointer_reader_thread(void *argument)
+{
+  (void)argument;
+
+  HazardPointerRecord *hazard_pointer_record = acquire_hazard_pointer_record(&benchmark_context.hazard_pointer_domain);
+
+  for (size_t lookup = 0; lookup < benchmark_context.lookups_per_thread; lookup++)
+  {
+    ChainNode *chain_node = atomic_load_explicit(&benchmark_context.head_node, memory_order_acquire);
+    size_t hazard_pointer_index = 0;
+
+    while (true)
+    {
+      set_hazard_pointer(hazard_pointer_record, hazard_pointer_index, chain_node);
+
+      ChainNode *current_head_node = atomic_load_explicit(&benchmark_context.head_node, memory_order_seq_cst);
+
+      if (current_head_node == chain_node)
+      {
+        break;
+      }
+
+      chain_node = current_head_node;
+    }
+
+    while (chain_node != NULL && chain_node->key != -1)
+    {
+      ChainNode *next_node = chain_node->next_node;
+
+      hazard_pointer_index ^= 1;
+
+      set_hazard_pointer(hazard_pointer_record, hazard_pointer_index, next_node);
+
+      if (chain_node->next_node != next_node)
+      {
+        printf("[ERROR] Unexpected relink.\n");
+      }
+
+      chain_node = next_node;
+    }
+
+    if (chain_node != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  release_hazard_pointer_record(hazard_pointer_record);
+
+  return NULL;
+}
+
+static void *run_writer_thread(void *argument)
+{
+  (void)argument;
+
+  EpochRecord *epoch_record = acquire_epoch_record(&benchmark_context.epoch_domain);
+  HazardPointerRecord *hazard_pointer_record = acquire_hazard_pointer_record(&benchmark_context.hazard_pointer_domain);
+
+  while (atomic_load_explicit(&benchmark_context.is_writer_running, memory_order_relaxed))
+  {
+    ChainNode *head_node = atomic_load_explicit(&benchmark_context.head_node, memory_order_relaxed);
+    ChainNode *new_node = (ChainNode *)malloc(sizeof(ChainNode));
+
+    if (new_node == NULL)
+    {
+      printf("[ERROR] Memory allocation failed for 'new_node'.\n");
+
+      break;
+    }
+
+    new_node->key = head_node->key;
+    new_node->next_node = head_node->next_node;
+
+    atomic_store_explicit(&benchmark_context.head_node, new_node, memory_order_release);
+
+    if (benchmark_context.uses_epochs)
+    {
+      retire_epoch_pointer(&benchmark_context.epoch_domain, epoch_record, head_node);
+    }
+    else
+    {
+      retire_hazard_pointer(&benchmark_context.hazard_pointer_domain, hazard_pointer_record, head_node);
+    }
+
+    benchmark_context.replaced_count++;
+  }
+
+  release_hazard_pointer_record(hazard_pointer_record);
+  release_epoch_record(epoch_record);
+
+  return NULL;
+}
+
+static void build_chain(size_t chain_length)
+{
+  ChainNode *head_node = NULL;
+
+  for (size_t node_index = chain_length; node_index > 0; node_index--)
+  {
+    ChainNode *chain_node = (ChainNode *)malloc(sizeof(ChainNode));
+
+    if (chain_node == NULL)
+    {
+      printf("[ERROR] Memory allocation failed for 'chain_node'.\n");
+
+      break;
+    }
+
+    chain_node->key = (int64_t)node_index;
+    chain_node->next_node = head_node;
+
+    head_node = chain_node;
+  }
+
+  atomic_store_explicit(&benchmark_context.head_node, head_node, memory_order_relaxed);
+}
+
+static void free_chain(void)
+{
+  ChainNode *chain_node = atomic_load_explicit(&benchmark_context.head_node, memory_order_relaxed);
+
+  while (chain_node != NULL)
+  {
+    ChainNode *next_node = chain_node->next_node;
+
+    free(chain_node);
+
+    chain_node = next_node;
+  }
+}
+
+static double run_readers(bool uses_epochs, int thread_count, size_t chain_length, size_t *pending_count)
+{
+  pthread_t reader_threads[64];
+  pthread_t writer_thread;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  build_chain(chain_length);
+  initialize_epoch_domain(&benchmark_context.epoch_domain, reclaim_chain_node);
+  initialize_hazard_pointer_domain(&benchmark_context.hazard_pointer_domain, reclaim_chain_node);
+
+  benchmark_context.uses_epochs = uses_epochs;
+  benchmark_context.replaced_count = 0;
+
+  atomic_store_explicit(&reclaimed_count, 0, memory_order_relaxed);
+  atomic_store_explicit(&benchmark_context.is_writer_running, true, memory_order_relaxed);
+
+  pthread_create(&writer_thread, NULL, run_writer_thread, NULL);
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_create(&reader_threads[thread_index], NULL, uses_epochs ? run_epoch_reader_thread : run_hazard_pointer_reader_thread, NULL);
+  }
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_join(reader_threads[thread_index], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  atomic_store_explicit(&benchmark_context.is_writer_running, false, memory_order_relaxed);
+
+  pthread_join(writer_thread, NULL);
+
+  *pending_count = benchmark_context.replaced_count - atomic_load_explicit(&reclaimed_count, memory_order_relaxed);
+
+  destroy_hazard_pointer_domain(&benchmark_context.hazard_pointer_domain);
+  destroy_epoch_domain(&benchmark_context.epoch_domain);
+  free_chain();
+
+  return get_elapsed_seconds(start_time, end_time);
+}
+
+int main(int argc, char *argv[])
+{
+  size_t chain_length = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000;
+
+  benchmark_context.lookups_per_thread = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000;
+
+  printf("threads  epoch Mlookups/s  pending  hazard pointer Mlookups/s  pending\n");
+
+  for (int thread_count = 1; thread_count <= 64; thread_count *= 2)
+  {
+    double lookup_count = (double)benchmark_context.lookups_per_thread * thread_count;
+    size_t epoch_pending_count = 0;
+    size_t hazard_pointer_pending_count = 0;
+
+    double epoch_seconds = run_readers(true, thread_count, chain_length, &epoch_pending_count);
+    double hazard_pointer_seconds = run_readers(false, thread_count, chain_length, &hazard_pointer_pending_count);
+
+    printf("%7d  %18.3f  %7zu  %25.3f  %7zu\n",
+           thread_count,
+           lookup_count / epoch_seconds / 1e6,
+           epoch_pending_count,
+           lookup_count / hazard_pointer_seconds / 1e6,
+           hazard_pointer_pending_count);
+  }
+
+  return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * Measures the throughput of a mixed workload of sorted lookups, insertions and deletions from 1 to 64 threads,
+ * comparing the hand-over-hand locking of `FineGrainedSinglyLinkedList` against the sorted operations of a
+ * `SinglyLinkedList` guarded by a single global mutex.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/fine_grained_singly_linked_list_benchmark.c src/fine_grained_singly_linked_list.c \
+ *     src/singly_linked_list.c src/node_pool.c src/hash_index.c src/skip_list_index.c src/singly_linked_list_compaction.c \
+ *     src/singly_linked_list_status.c -o fine_grained_singly_linked_list_benchmark
+ *   ./fine_grained_singly_linked_list_benchmark [operations_per_thread] [element_count]
+ *
+ * The list starts with the given number of even keys (1000 by default), and the key range is split into one
+ * disjoint region per thread. Every thread performs the given number of operations (2000 by default) in its own
+ * region: eight lookups of a stored key for every insertion and deletion of an odd key, so the length of the
+ * list stays the same.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/fine_grained_singly_linked_list.h"
+
+typedef struct Payload
+{
+  int64_t key;
+  double weight;
+} Payload;
+
+typedef struct BenchmarkContext
+{
+  FineGrainedSinglyLinkedList *fine_grained_singly_linked_list;
+  SinglyLinkedList *singly_linked_list;
+  pthread_mutex_t global_mutex;
+  size_t operations_per_thread;
+  size_t element_count;
+  int thread_count;
+} BenchmarkContext;
+
+typedef struct ThreadContext
+{
+  BenchmarkContext *benchmark_context;
+  int thread_index;
+} ThreadContext;
+
+static void print_payload(NodeData node_data)
+{
+  printf("%lld\n", (long long)((Payload *)node_data)->key);
+}
+
+static void free_payload(NodeData node_data)
+{
+  free(node_data);
+}
+
+static bool compare_payload_key(NodeData node_data, NodeData key)
+{
+  return ((Payload *)node_data)->key == ((Payload *)key)->key;
+}
+
+static int order_payload_keys(NodeData first_node_data, NodeData second_node_data)
+{
+  int64_t first_key = ((Payload *)first_node_data)->key;
+  int64_t second_key = ((Payload *)second_node_data)->key;
+
+  return (first_key > second_key) - (first_key < second_key);
+}
+
+static Payload *create_payload(int64_t key)
+{
+  Payload *payload = (Payload *)malloc(sizeof(Payload));
+
+  if (payload == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'payload'.\n");
+
+    exit(EXIT_FAILURE);
+  }
+
+  payload->key = key;
+  payload->weight = (double)key;
+
+  return payload;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void run_operations(ThreadContext *thread_context, bool is_fine_grained)
+{
+  BenchmarkContext *benchmark_context = thread_context->benchmark_context;
+  size_t region_size = benchmark_context->element_count / (size_t)benchmark_context->thread_count;
+  int64_t region_start = (int64_t)(2 * region_size * (size_t)thread_context->thread_index);
+
+  for (size_t operation = 0; operation < benchmark_context->operations_per_thread; operation++)
+  {
+    Payload key = {region_start + 2 * (int64_t)(operation % region_size), 0.0};
+    size_t step = operation % 10;
+
+    if (step == 8)
+    {
+      key.key++;
+
+      if (is_fine_grained)
+      {
+        insert_node_into_fine_grained_list(benchmark_context->fine_grained_singly_linked_list, create_payload(key.key));
+      }
+      else
+      {
+        Payload *payload = create_payload(key.key);
+
+        pthread_mutex_lock(&benchmark_context->global_mutex);
+        insert_node_into_sorted_list(benchmark_context->singly_linked_list, payload);
+        pthread_mutex_unlock(&benchmark_context->global_mutex);
+      }
+    }
+    else if (step == 9)
+    {
+      key.key = region_start + 2 * (int64_t)((operation - 1) % region_size) + 1;
+
+      if (is_fine_grained)
+      {
+        delete_node_from_fine_grained_list(benchmark_context->fine_grained_singly_linked_list, &key);
+      }
+      else
+      {
+        pthread_mutex_lock(&benchmark_context->global_mutex);
+        delete_node_from_sorted_list(benchmark_context->singly_linked_list, &key);
+        pthread_mutex_unlock(&benchmark_context->global_mutex);
+      }
+    }
+    else if (is_fine_grained)
+    {
+      if (find_node_data_in_fine_grained_list(benchmark_context->fine_grained_singly_linked_list, &key) == NULL)
+      {
+        printf("[ERROR] Missing key.\n");
+      }
+    }
+    else
+    {
+      pthread_mutex_lock(&benchmark_context->global_mutex);
+
+      if (find_node_in_sorted_list(benchmark_context->singly_linked_list, &key) == NULL)
+      {
+        printf("[ERROR] Missing key.\n");
+      }
+
+      pthread_mutex_unlock(&benchmark_context->global_mutex);
+    }
+  }
+}
+
+static void *run_fine_grained_thread(void *argument)
+{
+  run_operations((ThreadContext *)argument, true);
+
+  return NULL;
+}
+
+static void *run_global_lock_thread(void *argument)
+{
+  run_operations((ThreadContext *)argument, false);
+
+  return NULL;
+}
+
+static double run_threads(void *(*thread_function)(void *), BenchmarkContext *benchmark_context)
+{
+  pthread_t threads[64];
+  ThreadContext thread_contexts[64];
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int thread_index = 0; thread_index < benchmark_context->thread_count; thread_index++)
+  {
+    thread_contexts[thread_index].benchmark_context = benchmark_context;
+    thread_contexts[thread_index].thread_index = thread_index;
+
+    pthread_create(&threads[thread_index], NULL, thread_function, &thread_contexts[thread_index]);
+  }
+
+  for (int thread_index = 0; thread_index < benchmark_context->thread_count; thread_index++)
+  {
+    pthread_join(threads[thread_index], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  return get_elapsed_seconds(start_time, end_time);
+}
+
+int main(int argc, char *argv[])
+{
+  BenchmarkContext benchmark_context;
+
+  benchmark_context.operations_per_thread = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 2000;
+  benchmark_context.element_count = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000;
+  benchmark_context.fine_grained_singly_linked_list = create_fine_grained_singly_linked_list(free_payload, order_payload_keys);
+  benchmark_context.singly_linked_list = create_singly_linked_list(print_payload, free_payload, compare_payload_key);
+
+  set_order_data_function(benchmark_context.singly_linked_list, order_payload_keys);
+  pthread_mutex_init(&benchmark_context.global_mutex, NULL);
+
+  for (size_t element_index = 0; element_index < benchmark_context.element_count; element_index++)
+  {
+    insert_node_into_fine_grained_list(benchmark_context.fine_grained_singly_linked_list, create_payload(2 * (int64_t)element_index));
+    insert_node_at_tail(benchmark_context.singly_linked_list, create_payload(2 * (int64_t)element_index));
+  }
+
+  printf("threads  hand-over-hand Mops/s  global mutex Mops/s\n");
+
+  for (int thread_count = 1; thread_count <= 64; thread_count *= 2)
+  {
+    double operation_count = (double)benchmark_context.operations_per_thread * thread_count;
+
+    benchmark_context.thread_count = thread_count;
+
+    double fine_grained_seconds = run_threads(run_fine_grained_thread, &benchmark_context);
+    double global_lock_seconds = run_threads(run_global_lock_thread, &benchmark_context);
+
+    printf("%7d  %21.3f  %19.3f\n", thread_count, operation_count / fine_grained_seconds / 1e6, operation_count / global_lock_seconds / 1e6);
+  }
+
+  free_fine_grained_singly_linked_list(benchmark_context.fine_grained_singly_linked_list);
+  free(benchmark_context.fine_grained_singly_linked_list);
+  free_singly_linked_list(benchmark_context.singly_linked_list);
+  free(benchmark_context.singly_linked_list);
+
+  pthread_mutex_destroy(&benchmark_context.global_mutex);
+
+  return 0;
+}
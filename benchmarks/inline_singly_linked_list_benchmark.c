@@ -0,0 +1,142 @@
+/*
+ * Compares a full traversal of a `SinglyLinkedList` whose 16-byte payloads are allocated separately against the
+ * same traversal of an `InlineSinglyLinkedList` storing the payloads inside its nodes.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 benchmarks/inline_singly_linked_list_benchmark.c src/singly_linked_list.c src/node_pool.c \
+ *     src/hash_index.c src/skip_list_index.c src/singly_linked_list_compaction.c src/inline_singly_linked_list.c \
+ *     src/singly_linked_list_status.c -o inline_singly_linked_list_benchmark
+ *   ./inline_singly_linked_list_benchmark [element_count ...]
+ *
+ * Without arguments it measures lists of 1M and 10M elements. Every traversal searches for a key that is not
+ * stored, so both `find_node_by_data` and `find_node_in_inline_singly_linked_list` visit every element. The lists
+ * are built one after the other, so neither has its allocations interleaved with the other one.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/inline_singly_linked_list.h"
+#include "../include/singly_linked_list.h"
+
+typedef struct Payload
+{
+  int64_t key;
+  double weight;
+} Payload;
+
+static void print_payload(NodeData node_data)
+{
+  printf("%lld\n", (long long)((Payload *)node_data)->key);
+}
+
+static void free_payload(NodeData node_data)
+{
+  free(node_data);
+}
+
+static bool compare_payload_key(NodeData node_data, NodeData key)
+{
+  return ((Payload *)node_data)->key == *(int64_t *)key;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void run_benchmark(size_t element_count)
+{
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_payload, free_payload, compare_payload_key);
+  InlineSinglyLinkedList *inline_singly_linked_list = create_inline_singly_linked_list(sizeof(Payload), print_payload, NULL, compare_payload_key);
+
+  for (size_t element_index = 0; element_index < element_count; element_index++)
+  {
+    Payload *payload = (Payload *)malloc(sizeof(Payload));
+
+    if (payload == NULL)
+    {
+      printf("[ERROR] Memory allocation failed for 'payload'.\n");
+
+      break;
+    }
+
+    payload->key = (int64_t)element_index;
+    payload->weight = (double)element_index;
+
+    insert_node_at_tail(singly_linked_list, payload);
+  }
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    insert_element_at_inline_singly_linked_list_tail(inline_singly_linked_list, current_node->node_data);
+  }
+
+  int64_t missing_key = -1;
+  int repetitions = element_count >= 10000000 ? 1 : 10;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_node_by_data(singly_linked_list, &missing_key) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double singly_linked_list_seconds = get_elapsed_seconds(start_time, end_time) / repetitions;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_node_in_inline_singly_linked_list(inline_singly_linked_list, &missing_key) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double inline_singly_linked_list_seconds = get_elapsed_seconds(start_time, end_time) / repetitions;
+
+  printf("%zu elements: boxed payloads %.3f ms (%.2f ns/element), inline payloads %.3f ms (%.2f ns/element), speedup %.2fx\n",
+         element_count,
+         singly_linked_list_seconds * 1e3,
+         singly_linked_list_seconds * 1e9 / element_count,
+         inline_singly_linked_list_seconds * 1e3,
+         inline_singly_linked_list_seconds * 1e9 / element_count,
+         singly_linked_list_seconds / inline_singly_linked_list_seconds);
+
+  free_singly_linked_list(singly_linked_list);
+  free_inline_singly_linked_list(inline_singly_linked_list);
+  free(singly_linked_list);
+  free(inline_singly_linked_list);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2)
+  {
+    run_benchmark(1000000);
+    run_benchmark(10000000);
+
+    return 0;
+  }
+
+  for (int argument_index = 1; argument_index < argc; argument_index++)
+  {
+    run_benchmark((size_t)strtoull(argv[argument_index], NULL, 10));
+  }
+
+  return 0;
+}
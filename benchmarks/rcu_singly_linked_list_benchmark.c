@@ -0,0 +1,235 @@
+/*
+ * Measures the throughput of lookups in a read-mostly list of 64 entries from 1 to 64 reader threads while a writer
+ * thread replaces one entry every millisecond, comparing the lock-free readers of `RcuSinglyLinkedList` against
+ * `find_node_by_data` on a `SinglyLinkedList` guarded by a single global mutex.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/rcu_singly_linked_list_benchmark.c src/rcu_singly_linked_list.c \
+ *     src/epoch_reclamation.c src/singly_linked_list.c src/node_pool.c src/hash_index.c src/skip_list_index.c \
+ *     src/singly_linked_list_compaction.c src/singly_linked_list_status.c -o rcu_singly_linked_list_benchmark
+ *   ./rcu_singly_linked_list_benchmark [lookups_per_thread]
+ *
+ * Every reader performs the given number of lookups (1M by default) of keys spread over the whole list, and reads
+ * the weight of the entry it finds.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/rcu_singly_linked_list.h"
+
+#define ENTRY_COUNT 64
+
+typedef struct Payload
+{
+  int64_t key;
+  double weight;
+} Payload;
+
+typedef struct BenchmarkContext
+{
+  RcuSinglyLinkedList *rcu_singly_linked_list;
+  SinglyLinkedList *singly_linked_list;
+  pthread_mutex_t global_mutex;
+  atomic_bool is_writer_running;
+  size_t lookups_per_thread;
+} BenchmarkContext;
+
+static BenchmarkContext benchmark_context;
+
+static void print_payload(NodeData node_data)
+{
+  printf("%lld\n", (long long)((Payload *)node_data)->key);
+}
+
+static void free_payload(NodeData node_data)
+{
+  free(node_data);
+}
+
+static bool compare_payload_key(NodeData node_data, NodeData key)
+{
+  return ((Payload *)node_data)->key == *(int64_t *)key;
+}
+
+static Payload *create_payload(int64_t key, double weight)
+{
+  Payload *payload = (Payload *)malloc(sizeof(Payload));
+
+  if (payload == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'payload'.\n");
+
+    exit(EXIT_FAILURE);
+  }
+
+  payload->key = key;
+  payload->weight = weight;
+
+  return payload;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void *run_rcu_reader_thread(void *argument)
+{
+  EpochRecord *epoch_record = register_rcu_singly_linked_list_thread(benchmark_context.rcu_singly_linked_list);
+  double weight_sum = 0.0;
+
+  for (size_t lookup = 0; lookup < benchmark_context.lookups_per_thread; lookup++)
+  {
+    int64_t key = (int64_t)(lookup % ENTRY_COUNT);
+
+    enter_rcu_read_section(benchmark_context.rcu_singly_linked_list, epoch_record);
+
+    Payload *payload = (Payload *)find_node_data_in_rcu_list(benchmark_context.rcu_singly_linked_list, epoch_record, &key);
+
+    weight_sum += payload->weight;
+
+    exit_rcu_read_section(epoch_record);
+  }
+
+  unregister_rcu_singly_linked_list_thread(epoch_record);
+
+  *(double *)argument = weight_sum;
+
+  return NULL;
+}
+
+static void *run_global_lock_reader_thread(void *argument)
+{
+  double weight_sum = 0.0;
+
+  for (size_t lookup = 0; lookup < benchmark_context.lookups_per_thread; lookup++)
+  {
+    int64_t key = (int64_t)(lookup % ENTRY_COUNT);
+
+    pthread_mutex_lock(&benchmark_context.global_mutex);
+
+    Node *node = find_node_by_data(benchmark_context.singly_linked_list, &key);
+
+    weight_sum += ((Payload *)node->node_data)->weight;
+
+    pthread_mutex_unlock(&benchmark_context.global_mutex);
+  }
+
+  *(double *)argument = weight_sum;
+
+  return NULL;
+}
+
+static void *run_writer_thread(void *argument)
+{
+  bool uses_rcu = *(bool *)argument;
+  EpochRecord *epoch_record = uses_rcu ? register_rcu_singly_linked_list_thread(benchmark_context.rcu_singly_linked_list) : NULL;
+  struct timespec pause_time = {0, 1000000};
+  int64_t update = 0;
+
+  while (atomic_load_explicit(&benchmark_context.is_writer_running, memory_order_relaxed))
+  {
+    int64_t key = update % ENTRY_COUNT;
+    Payload *payload = create_payload(key, (double)++update);
+
+    if (uses_rcu)
+    {
+      replace_node_data_in_rcu_list(benchmark_context.rcu_singly_linked_list, epoch_record, &key, payload);
+    }
+    else
+    {
+      pthread_mutex_lock(&benchmark_context.global_mutex);
+
+      Node *node = find_node_by_data(benchmark_context.singly_linked_list, &key);
+
+      free_payload(node->node_data);
+      node->node_data = payload;
+
+      pthread_mutex_unlock(&benchmark_context.global_mutex);
+    }
+
+    nanosleep(&pause_time, NULL);
+  }
+
+  if (uses_rcu)
+  {
+    synchronize_rcu_singly_linked_list(benchmark_context.rcu_singly_linked_list, epoch_record);
+    unregister_rcu_singly_linked_list_thread(epoch_record);
+  }
+
+  return NULL;
+}
+
+static double run_readers(bool uses_rcu, int thread_count)
+{
+  pthread_t reader_threads[64];
+  double weight_sums[64];
+  pthread_t writer_thread;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  atomic_store_explicit(&benchmark_context.is_writer_running, true, memory_order_relaxed);
+
+  pthread_create(&writer_thread, NULL, run_writer_thread, &uses_rcu);
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_create(&reader_threads[thread_index], NULL, uses_rcu ? run_rcu_reader_thread : run_global_lock_reader_thread, &weight_sums[thread_index]);
+  }
+
+  for (int thread_index = 0; thread_index < thread_count; thread_index++)
+  {
+    pthread_join(reader_threads[thread_index], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  atomic_store_explicit(&benchmark_context.is_writer_running, false, memory_order_relaxed);
+
+  pthread_join(writer_thread, NULL);
+
+  return get_elapsed_seconds(start_time, end_time);
+}
+
+int main(int argc, char *argv[])
+{
+  benchmark_context.lookups_per_thread = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+  benchmark_context.rcu_singly_linked_list = create_rcu_singly_linked_list(free_payload, compare_payload_key);
+  benchmark_context.singly_linked_list = create_singly_linked_list(print_payload, free_payload, compare_payload_key);
+
+  pthread_mutex_init(&benchmark_context.global_mutex, NULL);
+
+  for (int64_t key = ENTRY_COUNT - 1; key >= 0; key--)
+  {
+    insert_node_at_rcu_head(benchmark_context.rcu_singly_linked_list, create_payload(key, 0.0));
+    insert_node_at_head(benchmark_context.singly_linked_list, create_payload(key, 0.0));
+  }
+
+  printf("threads  RCU Mlookups/s  global mutex Mlookups/s\n");
+
+  for (int thread_count = 1; thread_count <= 64; thread_count *= 2)
+  {
+    double lookup_count = (double)benchmark_context.lookups_per_thread * thread_count;
+    double rcu_seconds = run_readers(true, thread_count);
+    double global_lock_seconds = run_readers(false, thread_count);
+
+    printf("%7d  %14.2f  %23.2f\n", thread_count, lookup_count / rcu_seconds / 1e6, lookup_count / global_lock_seconds / 1e6);
+  }
+
+  free_rcu_singly_linked_list(benchmark_context.rcu_singly_linked_list);
+  free(benchmark_context.rcu_singly_linked_list);
+  free_singly_linked_list(benchmark_context.singly_linked_list);
+  free(benchmark_context.singly_linked_list);
+
+  pthread_mutex_destroy(&benchmark_context.global_mutex);
+
+  return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * Measures a full traversal of a `SinglyLinkedList` whose nodes were allocated in list order, of the same kind
+ * of list after its nodes were shuffled, and of the shuffled list after `compact_singly_linked_list`, first
+ * moving only the nodes and then moving the payloads too.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/singly_linked_list_compaction_benchmark.c src/singly_linked_list.c \
+ *     src/singly_linked_list_compaction.c src/singly_linked_list_sort.c src/node_pool.c src/hash_index.c \
+ *     src/skip_list_index.c src/singly_linked_list_status.c -o singly_linked_list_compaction_benchmark
+ *   ./singly_linked_list_compaction_benchmark [element_count ...]
+ *
+ * Without arguments it measures lists of 1M and 10M elements. Every traversal searches for a key that is not
+ * stored, so `find_node_by_data` visits every node and reads every payload. The shuffled list is built by tail
+ * insertion with random keys and then sorted by key, which relinks its nodes in an order unrelated to their
+ * addresses, as happens to lists that live through many insertions and deletions. Payloads are moved by
+ * copying them, in list order, into consecutive slots of an arena and freeing the originals.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/singly_linked_list.h"
+#include "../include/singly_linked_list_compaction.h"
+#include "../include/singly_linked_list_sort.h"
+
+typedef struct Payload
+{
+  int64_t key;
+  double weight;
+} Payload;
+
+static Payload *payload_arena = NULL;
+static size_t payload_arena_capacity = 0;
+static size_t payload_arena_used_count = 0;
+
+static bool is_in_payload_arena(NodeData node_data)
+{
+  return payload_arena != NULL && (Payload *)node_data >= payload_arena && (Payload *)node_data < payload_arena + payload_arena_capacity;
+}
+
+static void print_payload(NodeData node_data)
+{
+  printf("%lld\n", (long long)((Payload *)node_data)->key);
+}
+
+static void free_payload(NodeData node_data)
+{
+  if (!is_in_payload_arena(node_data))
+  {
+    free(node_data);
+  }
+}
+
+static bool compare_payload_key(NodeData node_data, NodeData key)
+{
+  return ((Payload *)node_data)->key == *(int64_t *)key;
+}
+
+static int order_payload_keys(NodeData first_node_data, NodeData second_node_data)
+{
+  int64_t first_key = ((Payload *)first_node_data)->key;
+  int64_t second_key = ((Payload *)second_node_data)->key;
+
+  return (first_key > second_key) - (first_key < second_key);
+}
+
+static NodeData relocate_payload(NodeData node_data)
+{
+  if (payload_arena_used_count == payload_arena_capacity)
+  {
+    return node_data;
+  }
+
+  Payload *payload = &payload_arena[payload_arena_used_count++];
+
+  *payload = *(Payload *)node_data;
+
+  free_payload(node_data);
+
+  return payload;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static SinglyLinkedList *build_list(size_t element_count, bool shuffled)
+{
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_payload, free_payload, compare_payload_key);
+  uint64_t random_state = 88172645463325252ULL;
+
+  for (size_t element_index = 0; element_index < element_count; element_index++)
+  {
+    Payload *payload = (Payload *)malloc(sizeof(Payload));
+
+    if (payload == NULL)
+    {
+      printf("[ERROR] Memory allocation failed for 'payload'.\n");
+
+      break;
+    }
+
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    payload->key = shuffled ? (int64_t)(random_state >> 1) : (int64_t)element_index;
+    payload->weight = (double)element_index;
+
+    insert_node_at_tail(singly_linked_list, payload);
+  }
+
+  if (shuffled)
+  {
+    set_order_data_function(singly_linked_list, order_payload_keys);
+    sort_singly_linked_list(singly_linked_list);
+  }
+
+  return singly_linked_list;
+}
+
+static double measure_traversal_seconds(SinglyLinkedList *singly_linked_list, int repetitions)
+{
+  int64_t missing_key = -1;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_node_by_data(singly_linked_list, &missing_key) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  return get_elapsed_seconds(start_time, end_time) / repetitions;
+}
+
+static void print_measurement(const char *label, size_t element_count, double traversal_seconds, double fresh_seconds)
+{
+  printf("  %-28s %9.3f ms (%6.2f ns/element), %.2fx the fresh list\n", label, traversal_seconds * 1e3, traversal_seconds * 1e9 / element_count, traversal_seconds / fresh_seconds);
+}
+
+static void run_benchmark(size_t element_count)
+{
+  int repetitions = element_count >= 10000000 ? 3 : 10;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  printf("%zu elements:\n", element_count);
+
+  SinglyLinkedList *fresh_singly_linked_list = build_list(element_count, false);
+  double fresh_seconds = measure_traversal_seconds(fresh_singly_linked_list, repetitions);
+
+  print_measurement("fresh", element_count, fresh_seconds, fresh_seconds);
+
+  free_singly_linked_list(fresh_singly_linked_list);
+  free(fresh_singly_linked_list);
+
+  SinglyLinkedList *singly_linked_list = build_list(element_count, true);
+
+  print_measurement("shuffled", element_count, measure_traversal_seconds(singly_linked_list, repetitions), fresh_seconds);
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  compact_singly_linked_list(singly_linked_list, NULL);
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  printf("  compacting the nodes took %.3f ms\n", get_elapsed_seconds(start_time, end_time) * 1e3);
+  print_measurement("compacted nodes", element_count, measure_traversal_seconds(singly_linked_list, repetitions), fresh_seconds);
+
+  payload_arena = (Payload *)malloc(element_count * sizeof(Payload));
+  payload_arena_capacity = payload_arena != NULL ? element_count : 0;
+  payload_arena_used_count = 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  compact_singly_linked_list(singly_linked_list, relocate_payload);
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  printf("  compacting the nodes and payloads took %.3f ms\n", get_elapsed_seconds(start_time, end_time) * 1e3);
+  print_measurement("compacted nodes and payloads", element_count, measure_traversal_seconds(singly_linked_list, repetitions), fresh_seconds);
+
+  free_singly_linked_list(singly_linked_list);
+  free(singly_linked_list);
+  free(payload_arena);
+
+  payload_arena = NULL;
+  payload_arena_capacity = 0;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2)
+  {
+    run_benchmark(1000000);
+    run_benchmark(10000000);
+
+    return 0;
+  }
+
+  for (int argument_index = 1; argument_index < argc; argument_index++)
+  {
+    run_benchmark((size_t)strtoull(argv[argument_index], NULL, 10));
+  }
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * Measures how `sort_singly_linked_list_in_parallel` scales from 1 to 32 threads against `sort_singly_linked_list`.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/singly_linked_list_parallel_sort_benchmark.c src/singly_linked_list.c \
+ *     src/singly_linked_list_sort.c src/node_pool.c src/hash_index.c src/skip_list_index.c \
+ *     src/singly_linked_list_compaction.c src/singly_linked_list_status.c -o singly_linked_list_parallel_sort_benchmark
+ *   ./singly_linked_list_parallel_sort_benchmark [element_count]
+ *
+ * The list holds 10M random elements by default. Every sorted list is checked to be in order.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/singly_linked_list.h"
+#include "../include/singly_linked_list_sort.h"
+
+static void print_int(NodeData node_data)
+{
+  printf("%d\n", *(int *)node_data);
+}
+
+static void free_nothing(NodeData node_data)
+{
+  (void)node_data;
+}
+
+static bool compare_int(NodeData first_data, NodeData second_data)
+{
+  return *(int *)first_data == *(int *)second_data;
+}
+
+static int order_int(NodeData first_data, NodeData second_data)
+{
+  int first_value = *(int *)first_data;
+  int second_value = *(int *)second_data;
+
+  return (first_value > second_value) - (first_value < second_value);
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static bool is_sorted(SinglyLinkedList *singly_linked_list, size_t element_count)
+{
+  size_t node_count = 0;
+  Node *previous_node = NULL;
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    if (previous_node != NULL && order_int(previous_node->node_data, current_node->node_data) > 0)
+    {
+      return false;
+    }
+
+    previous_node = current_node;
+    node_count++;
+  }
+
+  return node_count == element_count && singly_linked_list->tail_node == previous_node;
+}
+
+static double measure_sort(int *values, size_t element_count, size_t thread_count)
+{
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_int, free_nothing, compare_int);
+
+  set_order_data_function(singly_linked_list, order_int);
+
+  for (size_t value_index = 0; value_index < element_count; value_index++)
+  {
+    insert_node_at_tail(singly_linked_list, &values[value_index]);
+  }
+
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  if (thread_count == 0)
+  {
+    sort_singly_linked_list(singly_linked_list);
+  }
+  else
+  {
+    sort_singly_linked_list_in_parallel(singly_linked_list, thread_count);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  if (!is_sorted(singly_linked_list, element_count))
+  {
+    printf("[ERROR] The list is not sorted.\n");
+  }
+
+  free_singly_linked_list(singly_linked_list);
+  free(singly_linked_list);
+
+  return get_elapsed_seconds(start_time, end_time);
+}
+
+int main(int argc, char *argv[])
+{
+  size_t element_count = argc < 2 ? 10000000 : (size_t)strtoull(argv[1], NULL, 10);
+  int *values = (int *)malloc(element_count * sizeof(int));
+
+  if (values == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'values'.\n");
+
+    return 1;
+  }
+
+  uint64_t random_state = 88172645463325252ULL;
+
+  for (size_t value_index = 0; value_index < element_count; value_index++)
+  {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    values[value_index] = (int)(random_state >> 33);
+  }
+
+  double sequential_seconds = measure_sort(values, element_count, 0);
+
+  printf("%zu elements: sequential %.3f s\n", element_count, sequential_seconds);
+
+  for (size_t thread_count = 1; thread_count <= 32; thread_count *= 2)
+  {
+    double parallel_seconds = measure_sort(values, element_count, thread_count);
+
+    printf("%zu elements, %2zu threads: %.3f s, speedup %.2fx\n", element_count, thread_count, parallel_seconds, sequential_seconds / parallel_seconds);
+  }
+
+  free(values);
+
+  return 0;
+}
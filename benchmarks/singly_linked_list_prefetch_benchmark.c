@@ -0,0 +1,176 @@
+/*
+ * Measures how the prefetch distance of a `SinglyLinkedList` changes the cost of a full traversal, over a list
+ * whose nodes and payloads were allocated in list order and over the same kind of list after its nodes were
+ * shuffled.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/singly_linked_list_prefetch_benchmark.c src/singly_linked_list.c src/node_pool.c \
+ *     src/hash_index.c src/skip_list_index.c src/singly_linked_list_compaction.c src/singly_linked_list_sort.c \
+ *     src/singly_linked_list_status.c -o singly_linked_list_prefetch_benchmark
+ *   ./singly_linked_list_prefetch_benchmark [element_count ...]
+ *
+ * Without arguments it measures lists of 1M and 10M elements. Every traversal searches for a key that is not
+ * stored, so `find_node_by_data` visits every node and reads every payload. The fresh list is built by tail
+ * insertion, so consecutive nodes and payloads are neighbours in memory. The shuffled list is built the same
+ * way with random keys and then sorted by key, which relinks its nodes in an order unrelated to their addresses,
+ * as happens to lists that live through many insertions and deletions.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/singly_linked_list.h"
+#include "../include/singly_linked_list_sort.h"
+
+typedef struct Payload
+{
+  int64_t key;
+  double weight;
+} Payload;
+
+static void print_payload(NodeData node_data)
+{
+  printf("%lld\n", (long long)((Payload *)node_data)->key);
+}
+
+static void free_payload(NodeData node_data)
+{
+  free(node_data);
+}
+
+static bool compare_payload_key(NodeData node_data, NodeData key)
+{
+  return ((Payload *)node_data)->key == *(int64_t *)key;
+}
+
+static int order_payload_keys(NodeData first_node_data, NodeData second_node_data)
+{
+  int64_t first_key = ((Payload *)first_node_data)->key;
+  int64_t second_key = ((Payload *)second_node_data)->key;
+
+  return (first_key > second_key) - (first_key < second_key);
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static SinglyLinkedList *build_list(size_t element_count, bool shuffled)
+{
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_payload, free_payload, compare_payload_key);
+  uint64_t random_state = 88172645463325252ULL;
+
+  for (size_t element_index = 0; element_index < element_count; element_index++)
+  {
+    Payload *payload = (Payload *)malloc(sizeof(Payload));
+
+    if (payload == NULL)
+    {
+      printf("[ERROR] Memory allocation failed for 'payload'.\n");
+
+      break;
+    }
+
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    payload->key = shuffled ? (int64_t)(random_state >> 1) : (int64_t)element_index;
+    payload->weight = (double)element_index;
+
+    insert_node_at_tail(singly_linked_list, payload);
+  }
+
+  if (shuffled)
+  {
+    set_order_data_function(singly_linked_list, order_payload_keys);
+    sort_singly_linked_list(singly_linked_list);
+  }
+
+  return singly_linked_list;
+}
+
+static double measure_traversal_seconds(SinglyLinkedList *singly_linked_list, size_t prefetch_distance, int repetitions)
+{
+  int64_t missing_key = -1;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  set_prefetch_distance(singly_linked_list, prefetch_distance);
+
+  if (find_node_by_data(singly_linked_list, &missing_key) != NULL)
+  {
+    printf("[ERROR] Unexpected match.\n");
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_node_by_data(singly_linked_list, &missing_key) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  return get_elapsed_seconds(start_time, end_time) / repetitions;
+}
+
+static void run_benchmark(size_t element_count, bool shuffled)
+{
+  static const size_t prefetch_distances[] = {0, 1, 2, 4, 8, 16};
+  SinglyLinkedList *singly_linked_list = build_list(element_count, shuffled);
+  int repetitions = element_count >= 10000000 ? 3 : 10;
+  double baseline_seconds = 0.0;
+
+  printf("%zu elements, %s list:\n", element_count, shuffled ? "shuffled" : "fresh");
+
+  for (size_t distance_index = 0; distance_index < sizeof(prefetch_distances) / sizeof(prefetch_distances[0]); distance_index++)
+  {
+    double traversal_seconds = measure_traversal_seconds(singly_linked_list, prefetch_distances[distance_index], repetitions);
+
+    if (distance_index == 0)
+    {
+      baseline_seconds = traversal_seconds;
+    }
+
+    printf("  prefetch distance %2zu: %9.3f ms (%6.2f ns/element), speedup %.2fx\n",
+           prefetch_distances[distance_index],
+           traversal_seconds * 1e3,
+           traversal_seconds * 1e9 / element_count,
+           baseline_seconds / traversal_seconds);
+  }
+
+  free_singly_linked_list(singly_linked_list);
+  free(singly_linked_list);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2)
+  {
+    run_benchmark(1000000, false);
+    run_benchmark(1000000, true);
+    run_benchmark(10000000, false);
+    run_benchmark(10000000, true);
+
+    return 0;
+  }
+
+  for (int argument_index = 1; argument_index < argc; argument_index++)
+  {
+    size_t element_count = (size_t)strtoull(argv[argument_index], NULL, 10);
+
+    run_benchmark(element_count, false);
+    run_benchmark(element_count, true);
+  }
+
+  return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Compares `sort_singly_linked_list` and `radix_sort_singly_linked_list_by_integer_key` against copying the data of
+ * a `SinglyLinkedList` to an array, sorting it with `qsort` and rebuilding the list from it.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 -pthread benchmarks/singly_linked_list_sort_benchmark.c src/singly_linked_list.c \
+ *     src/singly_linked_list_sort.c src/node_pool.c src/hash_index.c src/skip_list_index.c \
+ *     src/singly_linked_list_compaction.c src/singly_linked_list_status.c -o singly_linked_list_sort_benchmark
+ *   ./singly_linked_list_sort_benchmark [element_count ...]
+ *
+ * Without arguments it sorts lists of 10M random elements. All the sorts are checked against each other.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/singly_linked_list.h"
+#include "../include/singly_linked_list_sort.h"
+
+static void print_int(NodeData node_data)
+{
+  printf("%d\n", *(int *)node_data);
+}
+
+static void free_nothing(NodeData node_data)
+{
+  (void)node_data;
+}
+
+static bool compare_int(NodeData first_data, NodeData second_data)
+{
+  return *(int *)first_data == *(int *)second_data;
+}
+
+static int order_int(NodeData first_data, NodeData second_data)
+{
+  int first_value = *(int *)first_data;
+  int second_value = *(int *)second_data;
+
+  return (first_value > second_value) - (first_value < second_value);
+}
+
+static uint64_t get_int_key(NodeData node_data)
+{
+  return (uint64_t)(uint32_t)*(int *)node_data ^ UINT64_C(0x80000000);
+}
+
+static int order_node_data(const void *first_element, const void *second_element)
+{
+  return order_int(*(NodeData const *)first_element, *(NodeData const *)second_element);
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static SinglyLinkedList *create_shuffled_list(int *values, size_t element_count)
+{
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_int, free_nothing, compare_int);
+
+  set_order_data_function(singly_linked_list, order_int);
+
+  for (size_t value_index = 0; value_index < element_count; value_index++)
+  {
+    insert_node_at_tail(singly_linked_list, &values[value_index]);
+  }
+
+  return singly_linked_list;
+}
+
+static bool sort_by_copying_to_array(SinglyLinkedList *singly_linked_list)
+{
+  size_t element_count = get_linked_list_size(singly_linked_list);
+  NodeData *node_data_array = (NodeData *)malloc(element_count * sizeof(NodeData));
+
+  if (node_data_array == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'node_data_array'.\n");
+
+    return false;
+  }
+
+  size_t node_index = 0;
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    node_data_array[node_index++] = current_node->node_data;
+  }
+
+  qsort(node_data_array, element_count, sizeof(NodeData), order_node_data);
+
+  free_singly_linked_list(singly_linked_list);
+
+  bool is_rebuilt = insert_nodes_at_tail_bulk(singly_linked_list, node_data_array, element_count);
+
+  free(node_data_array);
+
+  return is_rebuilt;
+}
+
+static bool have_same_order(SinglyLinkedList *first_list, SinglyLinkedList *second_list)
+{
+  Node *first_node = first_list->head_node;
+  Node *second_node = second_list->head_node;
+
+  while (first_node != NULL && second_node != NULL)
+  {
+    if (order_int(first_node->node_data, second_node->node_data) != 0)
+    {
+      return false;
+    }
+
+    first_node = first_node->next_node;
+    second_node = second_node->next_node;
+  }
+
+  if (first_node != NULL || second_node != NULL)
+  {
+    return false;
+  }
+
+  return first_list->tail_node == NULL ? second_list->tail_node == NULL : order_int(first_list->tail_node->node_data, second_list->tail_node->node_data) == 0;
+}
+
+static void run_benchmark(size_t element_count)
+{
+  int *values = (int *)malloc(element_count * sizeof(int));
+
+  if (values == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'values'.\n");
+
+    return;
+  }
+
+  uint64_t random_state = 88172645463325252ULL;
+
+  for (size_t value_index = 0; value_index < element_count; value_index++)
+  {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    values[value_index] = (int)(random_state >> 33);
+  }
+
+  SinglyLinkedList *merge_sorted_list = create_shuffled_list(values, element_count);
+  SinglyLinkedList *array_sorted_list = create_shuffled_list(values, element_count);
+  SinglyLinkedList *radix_sorted_list = create_shuffled_list(values, element_count);
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  bool is_merge_sorted = sort_singly_linked_list(merge_sorted_list);
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double merge_sort_seconds = get_elapsed_seconds(start_time, end_time);
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  bool is_array_sorted = sort_by_copying_to_array(array_sorted_list);
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double array_sort_seconds = get_elapsed_seconds(start_time, end_time);
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  bool is_radix_sorted = radix_sort_singly_linked_list_by_integer_key(radix_sorted_list, get_int_key);
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double radix_sort_seconds = get_elapsed_seconds(start_time, end_time);
+
+  if (!is_merge_sorted || !is_array_sorted || !is_radix_sorted || !have_same_order(merge_sorted_list, array_sorted_list) ||
+      !have_same_order(merge_sorted_list, radix_sorted_list))
+  {
+    printf("[ERROR] The sorted lists do not match.\n");
+  }
+
+  printf("%zu elements: merge sort %.3f s (%zu bytes of stack), radix sort %.3f s (%zu bytes of stack), array + qsort + rebuild %.3f s (%zu bytes of heap)\n",
+         element_count,
+         merge_sort_seconds,
+         2 * sizeof(size_t) * CHAR_BIT * sizeof(Node *),
+         radix_sort_seconds,
+         2 * 256 * sizeof(Node *),
+         array_sort_seconds,
+         element_count * sizeof(NodeData));
+
+  free_singly_linked_list(merge_sorted_list);
+  free_singly_linked_list(array_sorted_list);
+  free_singly_linked_list(radix_sorted_list);
+  free(merge_sorted_list);
+  free(array_sorted_list);
+  free(radix_sorted_list);
+  free(values);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2)
+  {
+    run_benchmark(10000000);
+
+    return 0;
+  }
+
+  for (int argument_index = 1; argument_index < argc; argument_index++)
+  {
+    run_benchmark((size_t)strtoull(argv[argument_index], NULL, 10));
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Compares a full traversal of a `SinglyLinkedList` against the same traversal of an `UnrolledLinkedList`.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -std=c11 benchmarks/unrolled_linked_list_benchmark.c src/singly_linked_list.c src/node_pool.c src/hash_index.c \
+ *     src/skip_list_index.c src/singly_linked_list_compaction.c src/unrolled_linked_list.c \
+ *     src/singly_linked_list_status.c -o unrolled_linked_list_benchmark
+ *   ./unrolled_linked_list_benchmark [element_count ...]
+ *
+ * Without arguments it measures lists of 1M and 100M elements. Every traversal searches for a value that is
+ * not stored, so both `find_node_by_data` and `find_data_in_unrolled_linked_list` visit every element.
+ *
+ * Before measuring, it checks that deleting data from an unrolled linked list whose head block is only partly
+ * full, as left by `insert_data_at_unrolled_linked_list_head`, keeps the blocks and the length consistent, and
+ * exits with a failure status if it does not.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/singly_linked_list.h"
+#include "../include/unrolled_linked_list.h"
+
+static void print_int(NodeData node_data)
+{
+  printf("%d\n", *(int *)node_data);
+}
+
+static void free_nothing(NodeData node_data)
+{
+  (void)node_data;
+}
+
+static bool compare_int(NodeData first_data, NodeData second_data)
+{
+  return *(int *)first_data == *(int *)second_data;
+}
+
+static bool has_unrolled_linked_list_values(UnrolledLinkedList *unrolled_linked_list, const int *expected_values, size_t expected_count)
+{
+  size_t value_index = 0;
+  UnrolledNode *last_node = NULL;
+
+  for (UnrolledNode *current_node = unrolled_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    for (size_t data_index = 0; data_index < current_node->data_count; data_index++)
+    {
+      if (value_index == expected_count || *(int *)current_node->node_data[data_index] != expected_values[value_index])
+      {
+        return false;
+      }
+
+      value_index++;
+    }
+
+    last_node = current_node;
+  }
+
+  return value_index == expected_count && unrolled_linked_list->length == expected_count && unrolled_linked_list->tail_node == last_node;
+}
+
+static bool check_delete_after_head_insert(void)
+{
+  static int values[] = {0, 1, 2, 3, 4, 5, 100, 101};
+  static const int values_after_miss[] = {101, 100, 0, 1, 2, 3, 4, 5};
+  static const int values_after_hit[] = {101, 100, 0, 1, 3, 4, 5};
+  UnrolledLinkedList *unrolled_linked_list = create_unrolled_linked_list(print_int, free_nothing, compare_int);
+
+  for (int value_index = 0; value_index < 6; value_index++)
+  {
+    insert_data_at_unrolled_linked_list_tail(unrolled_linked_list, &values[value_index]);
+  }
+
+  insert_data_at_unrolled_linked_list_head(unrolled_linked_list, &values[6]);
+  insert_data_at_unrolled_linked_list_head(unrolled_linked_list, &values[7]);
+
+  int missing_value = 999;
+  int present_value = 2;
+  bool is_consistent = delete_data_from_unrolled_linked_list(unrolled_linked_list, &missing_value) == 0 &&
+                       has_unrolled_linked_list_values(unrolled_linked_list, values_after_miss, 8) &&
+                       delete_data_from_unrolled_linked_list(unrolled_linked_list, &present_value) == 1 &&
+                       has_unrolled_linked_list_values(unrolled_linked_list, values_after_hit, 7);
+
+  free_unrolled_linked_list(unrolled_linked_list);
+  free(unrolled_linked_list);
+
+  return is_consistent;
+}
+
+static double get_elapsed_seconds(struct timespec start_time, struct timespec end_time)
+{
+  return (double)(end_time.tv_sec - start_time.tv_sec) + (double)(end_time.tv_nsec - start_time.tv_nsec) / 1e9;
+}
+
+static void run_benchmark(size_t element_count)
+{
+  int *values = (int *)malloc(element_count * sizeof(int));
+
+  if (values == NULL)
+  {
+    printf("[ERROR] Memory allocation failed for 'values'.\n");
+
+    return;
+  }
+
+  SinglyLinkedList *singly_linked_list = create_singly_linked_list(print_int, free_nothing, compare_int);
+  UnrolledLinkedList *unrolled_linked_list = create_unrolled_linked_list(print_int, free_nothing, compare_int);
+
+  for (size_t value_index = 0; value_index < element_count; value_index++)
+  {
+    values[value_index] = (int)value_index;
+
+    insert_node_at_tail(singly_linked_list, &values[value_index]);
+    insert_data_at_unrolled_linked_list_tail(unrolled_linked_list, &values[value_index]);
+  }
+
+  int missing_value = -1;
+  int repetitions = element_count >= 10000000 ? 1 : 10;
+  struct timespec start_time;
+  struct timespec end_time;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_node_by_data(singly_linked_list, &missing_value) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double singly_linked_list_seconds = get_elapsed_seconds(start_time, end_time) / repetitions;
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+  for (int repetition = 0; repetition < repetitions; repetition++)
+  {
+    if (find_data_in_unrolled_linked_list(unrolled_linked_list, &missing_value) != NULL)
+    {
+      printf("[ERROR] Unexpected match.\n");
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  double unrolled_linked_list_seconds = get_elapsed_seconds(start_time, end_time) / repetitions;
+
+  printf("%zu elements: singly linked list %.3f ms (%.2f ns/element), unrolled linked list %.3f ms (%.2f ns/element), speedup %.2fx\n",
+         element_count,
+         singly_linked_list_seconds * 1e3,
+         singly_linked_list_seconds * 1e9 / element_count,
+         unrolled_linked_list_seconds * 1e3,
+         unrolled_linked_list_seconds * 1e9 / element_count,
+         singly_linked_list_seconds / unrolled_linked_list_seconds);
+
+  free_singly_linked_list(singly_linked_list);
+  free_unrolled_linked_list(unrolled_linked_list);
+  free(singly_linked_list);
+  free(unrolled_linked_list);
+  free(values);
+}
+
+int main(int argc, char *argv[])
+{
+  if (!check_delete_after_head_insert())
+  {
+    printf("[ERROR] Deleting data after a head insertion corrupted the unrolled linked list.\n");
+
+    return EXIT_FAILURE;
+  }
+
+  if (argc < 2)
+  {
+    run_benchmark(1000000);
+    run_benchmark(100000000);
+
+    return 0;
+  }
+
+  for (int argument_index = 1; argument_index < argc; argument_index++)
+  {
+    run_benchmark((size_t)strtoull(argv[argument_index], NULL, 10));
+  }
+
+  return 0;
+}
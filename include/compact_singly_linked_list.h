@@ -0,0 +1,174 @@
+#ifndef COMPACT_SINGLY_LINKED_LIST_H
+#define COMPACT_SINGLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def COMPACT_NODE_NULL_INDEX
+ * \brief The index that marks the absence of a node, like `NULL` does for a `Node` pointer.
+ */
+#define COMPACT_NODE_NULL_INDEX UINT32_MAX
+
+/**
+ * \def COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY
+ * \brief The maximum number of nodes of a compact singly linked list, since one index value is reserved for `COMPACT_NODE_NULL_INDEX`.
+ */
+#define COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY ((size_t)UINT32_MAX)
+
+/**
+ * \struct CompactSinglyLinkedList
+ * \brief A structure representing a singly linked list whose nodes live in growable arrays and link to each other by index.
+ *
+ * Node `i` is made of `node_data_array[i]` and `next_index_array[i]`. Keeping the two fields in separate arrays
+ * avoids the 4 bytes of padding a `{ NodeData; uint32_t; }` structure would get on 64-bit hosts, and the
+ * traversal of the links only touches the dense index array until the data is needed. Nodes released by
+ * deletions are kept in a free index list, linked through their own `next_index_array` slot, and are reused
+ * before the arrays grow. Since nodes are referred to by index, the arrays can be moved by `realloc` without
+ * invalidating them.
+ *
+ * Memory per element on a 64-bit host:
+ *
+ * | List                      | Link                 | Data    | Total                               |
+ * |---------------------------|----------------------|---------|-------------------------------------|
+ * | `SinglyLinkedList`        | 8 bytes (`Node *`)   | 8 bytes | 16 bytes, in `NodePool` slabs       |
+ * | `CompactSinglyLinkedList` | 4 bytes (`uint32_t`) | 8 bytes | 12 bytes at full capacity, 25% less |
+ *
+ * The arrays double when they are full, so right after growing a compact list uses up to 24 bytes per element
+ * until the new slots are filled. `reserve_compact_singly_linked_list_capacity` sizes them exactly when the number
+ * of elements is known in advance. The payloads pointed to by `NodeData` are not included in either figure.
+ */
+typedef struct CompactSinglyLinkedList
+{
+  NodeData *node_data_array;                 /**< The data of every node, by index. */
+  uint32_t *next_index_array;                /**< The index of the node following every node, or `COMPACT_NODE_NULL_INDEX`. */
+  size_t capacity;                           /**< Number of nodes the arrays can hold. */
+  size_t used_count;                         /**< Number of slots of the arrays that have ever been handed out. */
+  uint32_t free_index;                       /**< Index of the first released node, or `COMPACT_NODE_NULL_INDEX` if there is none. */
+  uint32_t head_index;                       /**< Index of the first node in the list, or `COMPACT_NODE_NULL_INDEX`. */
+  uint32_t tail_index;                       /**< Index of the last node in the list, or `COMPACT_NODE_NULL_INDEX`. */
+  size_t length;                             /**< Number of nodes currently in the list. */
+  PrintDataFunction print_data_function;     /**< Function pointer for printing node data. */
+  FreeDataFunction free_data_function;       /**< Function pointer for freeing node data. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing node data. */
+} CompactSinglyLinkedList;
+
+/**
+ * \brief Creates a new empty compact singly linked list with the provided function pointers.
+ *
+ * This function allocates memory for a new `CompactSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing node data. No node array is allocated
+ * until the first insertion. If any of the function pointers is NULL or the allocation fails, an error is
+ * reported and the function returns `NULL`.
+ *
+ * \param print_data_function A function pointer used to print the data of a node.
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ *
+ * \return A pointer to the newly created `CompactSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+CompactSinglyLinkedList *create_compact_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Grows the node arrays of the compact singly linked list to hold at least the provided number of nodes.
+ *
+ * The arrays are never shrunk. Reserving the final size up front avoids both the copies made while doubling
+ * and the unused slots left by the last doubling.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be grown.
+ * \param capacity The number of nodes the arrays must be able to hold, up to `COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY`.
+ *
+ * \return true if the arrays can hold `capacity` nodes, false if an error occurred and they were left untouched.
+ */
+bool reserve_compact_singly_linked_list_capacity(CompactSinglyLinkedList *compact_singly_linked_list, size_t capacity);
+
+/**
+ * \brief Inserts a new node at the head of the compact singly linked list.
+ *
+ * The node reuses a released slot if there is one, and otherwise takes the next unused slot of the arrays,
+ * which are doubled when they are full.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_at_compact_singly_linked_list_head(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Inserts a new node at the tail of the compact singly linked list.
+ *
+ * The node reuses a released slot if there is one, and otherwise takes the next unused slot of the arrays,
+ * which are doubled when they are full.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_at_compact_singly_linked_list_tail(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Prints all the nodes in the compact singly linked list, from head to tail.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be printed.
+ */
+void print_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list);
+
+/**
+ * \brief Frees the data of all the nodes in the compact singly linked list, releases its arrays and leaves it empty.
+ *
+ * The list structure itself is not freed.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be freed.
+ */
+void free_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list);
+
+/**
+ * \brief Returns the number of nodes in the compact singly linked list in constant time.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_compact_singly_linked_list_length(CompactSinglyLinkedList *compact_singly_linked_list);
+
+/**
+ * \brief Reverses the order of the nodes in the compact singly linked list by rewriting their next indices.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be reversed.
+ */
+void reverse_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list);
+
+/**
+ * \brief Searches for the first node of the compact singly linked list whose data matches the provided data.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to search in.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The index of the matching node, whose data is `node_data_array[index]`, or `COMPACT_NODE_NULL_INDEX`
+ * if no node is found.
+ */
+uint32_t find_node_in_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Checks if a compact singly linked list is valid.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be checked.
+ *
+ * \return true if the compact singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list);
+
+/**
+ * \brief Deletes every node of the compact singly linked list whose data matches the provided data.
+ *
+ * The data of the deleted nodes is freed and their slots are pushed onto the free index list for reuse.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` from which nodes will be deleted.
+ * \param node_data The data to search for in the list. Nodes with matching data will be deleted.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_node_from_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data);
+
+#endif
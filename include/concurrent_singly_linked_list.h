@@ -0,0 +1,111 @@
+#ifndef CONCURRENT_SINGLY_LINKED_LIST_H
+#define CONCURRENT_SINGLY_LINKED_LIST_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "hazard_pointer.h"
+#include "singly_linked_list.h"
+
+/**
+ * \struct ConcurrentSinglyLinkedList
+ * \brief A structure representing a singly linked list whose head can be used by several threads at once.
+ *
+ * This structure is the concurrent mode of `SinglyLinkedList`: insertion at the head and removal from
+ * the head are lock-free, using a compare-and-swap loop on `head_node` (a Treiber stack). Removed nodes
+ * are retired in a hazard pointer domain and only freed once no thread can still be reading them.
+ *
+ * `head_node` and `length` are each on their own cache line, so that the compare-and-swap loops on the
+ * head do not contend with the updates of the counter.
+ */
+typedef struct ConcurrentSinglyLinkedList
+{
+  _Alignas(HAZARD_POINTER_CACHE_LINE_SIZE) _Atomic(Node *) head_node; /**< Pointer to the first node in the list. */
+  _Alignas(HAZARD_POINTER_CACHE_LINE_SIZE) atomic_size_t length;      /**< Approximate number of nodes in the list. */
+  FreeDataFunction free_data_function;                                /**< Function pointer for freeing node data. */
+  HazardPointerDomain hazard_pointer_domain;                          /**< Domain protecting the nodes removed from the list. */
+} ConcurrentSinglyLinkedList;
+
+/**
+ * \brief Creates a new concurrent singly linked list.
+ *
+ * This function allocates memory for a new `ConcurrentSinglyLinkedList` and initializes its hazard
+ * pointer domain. If `free_data_function` is NULL or the allocation fails, an error message is printed
+ * and the function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ *
+ * \return A pointer to the newly created `ConcurrentSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+ConcurrentSinglyLinkedList *create_concurrent_singly_linked_list(FreeDataFunction free_data_function);
+
+/**
+ * \brief Registers the calling thread with a concurrent singly linked list.
+ *
+ * Every thread that removes nodes from the list needs its own hazard pointer record, which it passes
+ * to `pop_node_from_concurrent_head` and gives back with `unregister_concurrent_singly_linked_list_thread`.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list the thread will use.
+ *
+ * \return A pointer to the hazard pointer record of the thread, or `NULL` if none is available.
+ */
+HazardPointerRecord *register_concurrent_singly_linked_list_thread(ConcurrentSinglyLinkedList *concurrent_singly_linked_list);
+
+/**
+ * \brief Gives back the hazard pointer record of a thread that no longer uses the list.
+ *
+ * \param hazard_pointer_record A pointer to the record returned by `register_concurrent_singly_linked_list_thread`.
+ */
+void unregister_concurrent_singly_linked_list_thread(HazardPointerRecord *hazard_pointer_record);
+
+/**
+ * \brief Inserts a new node at the head of the concurrent singly linked list.
+ *
+ * This function creates a new node with `create_node` and publishes it with a compare-and-swap loop on
+ * `head_node`, so it can be called by any number of threads at the same time without a lock.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_at_concurrent_head(ConcurrentSinglyLinkedList *concurrent_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Removes the node at the head of the concurrent singly linked list and returns its data.
+ *
+ * This function protects the current head with a hazard pointer, then swings `head_node` to the next
+ * node with a compare-and-swap. The removed node is retired and freed once no other thread holds it as
+ * a hazard pointer. The ownership of the returned data passes to the caller.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list to remove the node from.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ *
+ * \return The data of the removed node, or `NULL` if the list is empty.
+ */
+NodeData pop_node_from_concurrent_head(ConcurrentSinglyLinkedList *concurrent_singly_linked_list, HazardPointerRecord *hazard_pointer_record);
+
+/**
+ * \brief Returns the number of nodes in the concurrent singly linked list.
+ *
+ * The count is approximate: it is incremented before a node is linked and decremented after one is unlinked,
+ * so while other threads modify the list it can be briefly above the number of reachable nodes, but never below.
+ * It is exact once no thread is modifying the list.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_concurrent_singly_linked_list_length(ConcurrentSinglyLinkedList *concurrent_singly_linked_list);
+
+/**
+ * \brief Frees all the nodes of the concurrent singly linked list and every node still retired.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list to be freed.
+ */
+void free_concurrent_singly_linked_list(ConcurrentSinglyLinkedList *concurrent_singly_linked_list);
+
+#endif
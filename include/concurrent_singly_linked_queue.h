@@ -0,0 +1,112 @@
+#ifndef CONCURRENT_SINGLY_LINKED_QUEUE_H
+#define CONCURRENT_SINGLY_LINKED_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "hazard_pointer.h"
+#include "singly_linked_list.h"
+
+/**
+ * \struct ConcurrentQueueNode
+ * \brief A structure representing a node of a concurrent singly linked queue.
+ *
+ * This structure has the same layout as `Node`, but its `next_node` pointer is atomic, since it is
+ * updated with compare-and-swap by the enqueuing threads.
+ */
+typedef struct ConcurrentQueueNode
+{
+  NodeData node_data;                            /**< Pointer to the data stored in the node. */
+  _Atomic(struct ConcurrentQueueNode *) next_node; /**< Pointer to the next node in the queue. */
+} ConcurrentQueueNode;
+
+/**
+ * \struct ConcurrentSinglyLinkedQueue
+ * \brief A structure representing a lock-free multi-producer, multi-consumer FIFO queue.
+ *
+ * This structure implements the Michael-Scott queue on top of a `head_node` and a `tail_node`. The head
+ * always points to a sentinel node whose data has already been dequeued, so enqueuers only touch the tail
+ * and dequeuers only touch the head. Dequeued sentinels are retired in a hazard pointer domain and freed
+ * once no thread can still be reading them.
+ *
+ * `head_node` and `tail_node` are each on their own cache line, so that enqueuers and dequeuers do not
+ * invalidate each other's line on every compare-and-swap.
+ */
+typedef struct ConcurrentSinglyLinkedQueue
+{
+  _Alignas(HAZARD_POINTER_CACHE_LINE_SIZE) _Atomic(ConcurrentQueueNode *) head_node; /**< Pointer to the sentinel node at the front of the queue. */
+  _Alignas(HAZARD_POINTER_CACHE_LINE_SIZE) _Atomic(ConcurrentQueueNode *) tail_node; /**< Pointer to the last node in the queue, or a node close to it. */
+  FreeDataFunction free_data_function;                                               /**< Function pointer for freeing node data. */
+  HazardPointerDomain hazard_pointer_domain;                                         /**< Domain protecting the nodes removed from the queue. */
+} ConcurrentSinglyLinkedQueue;
+
+/**
+ * \brief Creates a new concurrent singly linked queue.
+ *
+ * This function allocates memory for a new `ConcurrentSinglyLinkedQueue` and its sentinel node, and
+ * initializes its hazard pointer domain. If `free_data_function` is NULL or an allocation fails, an error
+ * message is printed and the function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ *
+ * \return A pointer to the newly created `ConcurrentSinglyLinkedQueue` if successful, or `NULL` if an error occurs.
+ */
+ConcurrentSinglyLinkedQueue *create_concurrent_singly_linked_queue(FreeDataFunction free_data_function);
+
+/**
+ * \brief Registers the calling thread with a concurrent singly linked queue.
+ *
+ * Every thread that uses the queue needs its own hazard pointer record, which it passes to `enqueue_node_data`
+ * and `dequeue_node_data` and gives back with `unregister_concurrent_singly_linked_queue_thread`.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue the thread will use.
+ *
+ * \return A pointer to the hazard pointer record of the thread, or `NULL` if none is available.
+ */
+HazardPointerRecord *register_concurrent_singly_linked_queue_thread(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue);
+
+/**
+ * \brief Gives back the hazard pointer record of a thread that no longer uses the queue.
+ *
+ * \param hazard_pointer_record A pointer to the record returned by `register_concurrent_singly_linked_queue_thread`.
+ */
+void unregister_concurrent_singly_linked_queue_thread(HazardPointerRecord *hazard_pointer_record);
+
+/**
+ * \brief Appends data at the tail of the concurrent singly linked queue.
+ *
+ * This function links a new node after the last node with a compare-and-swap on its `next_node`, then
+ * tries to swing `tail_node` to it. If the tail is lagging behind, it is advanced first.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue where the data will be appended.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ * \param node_data The data to be enqueued. This cannot be `NULL`.
+ *
+ * \return true if the data was enqueued, false if an error occurred.
+ */
+bool enqueue_node_data(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue, HazardPointerRecord *hazard_pointer_record, NodeData node_data);
+
+/**
+ * \brief Removes the data at the front of the concurrent singly linked queue.
+ *
+ * This function moves `head_node` to the node following the current sentinel, which becomes the new
+ * sentinel, and returns its data. The previous sentinel is retired. The ownership of the returned data
+ * passes to the caller.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue to remove the data from.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ *
+ * \return The data at the front of the queue, or `NULL` if the queue is empty.
+ */
+NodeData dequeue_node_data(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue, HazardPointerRecord *hazard_pointer_record);
+
+/**
+ * \brief Frees every node of the concurrent singly linked queue, including the sentinel.
+ *
+ * No thread may be using the queue while it is freed. Afterward, the queue must not be used again.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue to be freed.
+ */
+void free_concurrent_singly_linked_queue(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue);
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef EPOCH_RECLAMATION_H
+#define EPOCH_RECLAMATION_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \def EPOCH_RECLAMATION_MAX_RECORDS
+ * \brief The maximum number of threads that can hold an epoch record of a domain at the same time.
+ */
+#ifndef EPOCH_RECLAMATION_MAX_RECORDS
+#define EPOCH_RECLAMATION_MAX_RECORDS 128
+#endif
+
+/**
+ * \def EPOCH_RECLAMATION_RETIRE_THRESHOLD
+ * \brief The number of pointers a record retires before it tries to advance the epoch and reclaim them.
+ *
+ * Larger values make every reclamation pass free a bigger batch at once, at the cost of more memory held
+ * by retired pointers in between.
+ */
+#ifndef EPOCH_RECLAMATION_RETIRE_THRESHOLD
+#define EPOCH_RECLAMATION_RETIRE_THRESHOLD 64
+#endif
+
+/**
+ * \def EPOCH_RECLAMATION_CACHE_LINE_SIZE
+ * \brief The alignment of every epoch record, so that readers entering critical sections on different
+ * threads do not write to the same cache line.
+ */
+#ifndef EPOCH_RECLAMATION_CACHE_LINE_SIZE
+#define EPOCH_RECLAMATION_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * \def EPOCH_RECLAMATION_BATCH_COUNT
+ * \brief The number of batches of retired pointers kept by every record, one per epoch that may still be observed.
+ */
+#define EPOCH_RECLAMATION_BATCH_COUNT 3
+
+/**
+ * \typedef void (*ReclaimFunction)(void *)
+ * \brief A function pointer type for a function that releases a retired pointer.
+ */
+typedef void (*ReclaimFunction)(void *);
+
+/**
+ * \struct EpochRetiredBatch
+ * \brief A structure representing the pointers retired by one thread during one epoch.
+ *
+ * The array of retired pointers is allocated on the first retirement and grows by doubling.
+ */
+typedef struct EpochRetiredBatch
+{
+  void **retired_pointers; /**< Pointers unlinked by the owning thread during epoch `retire_epoch`. */
+  size_t retired_count;    /**< Number of entries of `retired_pointers` in use. */
+  size_t retired_capacity; /**< Number of entries allocated for `retired_pointers`. */
+  size_t retire_epoch;     /**< The global epoch the pointers were retired in. */
+} EpochRetiredBatch;
+
+/**
+ * \struct EpochRecord
+ * \brief A structure representing the announced epoch and the retired pointers of one thread.
+ *
+ * A record is owned by a single thread between `acquire_epoch_record` and `release_epoch_record`. Its
+ * announced epoch is read by every thread that tries to advance the global epoch, while its batches of
+ * retired pointers are only ever touched by the owning thread.
+ */
+typedef struct EpochRecord
+{
+  _Alignas(EPOCH_RECLAMATION_CACHE_LINE_SIZE) atomic_size_t announced_epoch; /**< Twice the epoch observed on entering the current critical section plus one, or 0 outside of it. */
+  atomic_bool is_active;                                                     /**< Whether the record is owned by a thread. */
+  size_t critical_section_depth;                                             /**< Number of nested critical sections the owning thread is in. */
+  size_t pending_retired_count;                                              /**< Number of pointers retired since the last reclamation pass. */
+  EpochRetiredBatch retired_batches[EPOCH_RECLAMATION_BATCH_COUNT];          /**< Retired pointers, indexed by their epoch modulo `EPOCH_RECLAMATION_BATCH_COUNT`. */
+} EpochRecord;
+
+/**
+ * \struct EpochDomain
+ * \brief A structure representing a set of epoch records that protect the same kind of objects.
+ *
+ * A thread reads the shared structure only inside a critical section, during which it announces the global
+ * epoch it observed on entry. The global epoch only advances once every thread inside a critical section
+ * has announced it, so a pointer retired during epoch `e` can no longer be reached by any thread once the
+ * global epoch reaches `e + 2`, and is then released with `reclaim_function`.
+ */
+typedef struct EpochDomain
+{
+  EpochRecord records[EPOCH_RECLAMATION_MAX_RECORDS]; /**< The records of the domain. */
+  atomic_size_t global_epoch;                         /**< The current epoch of the domain. */
+  ReclaimFunction reclaim_function;                   /**< Function pointer for releasing retired pointers. */
+} EpochDomain;
+
+/**
+ * \brief Initializes an epoch domain.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to be initialized.
+ * \param reclaim_function A function pointer used to release retired pointers. This cannot be `NULL`.
+ */
+void initialize_epoch_domain(EpochDomain *epoch_domain, ReclaimFunction reclaim_function);
+
+/**
+ * \brief Releases every pointer still retired in the domain and the memory used by its records.
+ *
+ * No thread may be using the domain while it is destroyed.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to be destroyed.
+ */
+void destroy_epoch_domain(EpochDomain *epoch_domain);
+
+/**
+ * \brief Acquires an unused record of the domain for the calling thread.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to acquire the record from.
+ *
+ * \return A pointer to the acquired record, or `NULL` if all `EPOCH_RECLAMATION_MAX_RECORDS` records are in use.
+ */
+EpochRecord *acquire_epoch_record(EpochDomain *epoch_domain);
+
+/**
+ * \brief Gives a record back to the domain.
+ *
+ * The owning thread must have left every critical section. The pointers retired through the record stay
+ * in it and are reclaimed by its next owner or when the domain is destroyed.
+ *
+ * \param epoch_record A pointer to the record to be released.
+ */
+void release_epoch_record(EpochRecord *epoch_record);
+
+/**
+ * \brief Enters a critical section, during which the pointers read from the shared structure stay valid.
+ *
+ * Entering costs a store of the announced epoch and a fence, and no write to memory shared with other
+ * readers. Critical sections can be nested, in which case only the outermost one announces the epoch.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record of the calling thread.
+ */
+void enter_epoch_critical_section(EpochDomain *epoch_domain, EpochRecord *epoch_record);
+
+/**
+ * \brief Leaves a critical section entered with `enter_epoch_critical_section`.
+ *
+ * Once the outermost critical section is left, no pointer read during it may be used anymore.
+ *
+ * \param epoch_record A pointer to the record of the calling thread.
+ */
+void exit_epoch_critical_section(EpochRecord *epoch_record);
+
+/**
+ * \brief Retires a pointer that is no longer reachable from the shared structure.
+ *
+ * The pointer is released with the `reclaim_function` of the domain once every thread that could still
+ * hold it has left its critical section. Every `EPOCH_RECLAMATION_RETIRE_THRESHOLD` retirements the record
+ * tries to advance the global epoch and releases every batch that has become safe at once. If the batch of
+ * the current epoch cannot grow, even after the batches that have become safe are released, the function
+ * waits for the grace period of the pointer and releases it itself, which requires the calling thread to be
+ * outside of any critical section.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record of the calling thread.
+ * \param pointer The pointer to be retired.
+ */
+void retire_epoch_pointer(EpochDomain *epoch_domain, EpochRecord *epoch_record, void *pointer);
+
+/**
+ * \brief Advances the global epoch of the domain if every thread inside a critical section has observed it.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` whose epoch is to be advanced.
+ *
+ * \return true if the global epoch has advanced since the call started, false if a thread still lags behind.
+ */
+bool try_advance_epoch(EpochDomain *epoch_domain);
+
+/**
+ * \brief Tries to advance the global epoch and releases every batch of a record that has become safe.
+ *
+ * A thread inside a critical section keeps the epoch from advancing more than once past the one it announced,
+ * so the pointers it retired during that critical section are only reclaimed by a later call made outside of it.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record whose retired pointers are to be reclaimed.
+ *
+ * \return The number of pointers of the record still awaiting reclamation.
+ */
+size_t reclaim_epoch_retired_pointers(EpochDomain *epoch_domain, EpochRecord *epoch_record);
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef FINE_GRAINED_SINGLY_LINKED_LIST_H
+#define FINE_GRAINED_SINGLY_LINKED_LIST_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \struct FineGrainedNode
+ * \brief A structure representing a node of a fine-grained singly linked list, guarded by its own mutex.
+ *
+ * The `next_node` pointer of a node is only read or written while holding its `node_mutex`, so a thread
+ * that holds the mutex of a node can neither see the node unlinked nor its successor changed.
+ */
+typedef struct FineGrainedNode
+{
+  NodeData node_data;                /**< Pointer to the data stored in the node. */
+  struct FineGrainedNode *next_node; /**< Pointer to the next node in the list. */
+  pthread_mutex_t node_mutex;        /**< Mutex guarding `next_node`. */
+} FineGrainedNode;
+
+/**
+ * \struct FineGrainedSinglyLinkedList
+ * \brief A structure representing a sorted singly linked list that several threads can modify at once.
+ *
+ * Every operation walks the list with hand-over-hand locking: it locks the mutex of the next node before
+ * unlocking the one of the current node, starting from `head_sentinel`. Since all threads lock nodes in
+ * list order, they never deadlock, and threads working on different regions of a long list only wait for
+ * each other while one of them passes through the region of the other.
+ */
+typedef struct FineGrainedSinglyLinkedList
+{
+  FineGrainedNode head_sentinel;         /**< Sentinel node without data, whose `next_node` is the first node in the list. */
+  atomic_size_t length;                  /**< Number of nodes currently in the list. */
+  FreeDataFunction free_data_function;   /**< Function pointer for freeing node data. */
+  OrderDataFunction order_data_function; /**< Function pointer for ordering node data. */
+} FineGrainedSinglyLinkedList;
+
+/**
+ * \brief Creates a new fine-grained singly linked list.
+ *
+ * This function allocates memory for a new `FineGrainedSinglyLinkedList` and initializes the mutex of its
+ * sentinel. If a function pointer is NULL or an allocation fails, an error message is printed and the
+ * function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param order_data_function A function pointer used to order the data of the nodes.
+ *
+ * \return A pointer to the newly created `FineGrainedSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+FineGrainedSinglyLinkedList *create_fine_grained_singly_linked_list(FreeDataFunction free_data_function, OrderDataFunction order_data_function);
+
+/**
+ * \brief Inserts a new node into the fine-grained singly linked list, keeping it sorted.
+ *
+ * This function links the new node after every node whose data goes before or is equivalent to `node_data`
+ * according to the `order_data_function` of the list, so insertions are stable. Only the predecessor of the
+ * new node stays locked while it is linked.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_into_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Searches the fine-grained singly linked list for the first node whose data is equivalent to the provided data.
+ *
+ * Nodes are matched with the `order_data_function` of the list, and the search stops at the first node that
+ * goes after `node_data`. The returned data is still owned by the list, so a caller that lets other threads
+ * delete the matching node concurrently must coordinate the lifetime of the data itself.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list to search in.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The data of the first matching node, or `NULL` if no node matches or an error occurs.
+ */
+NodeData find_node_data_in_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Deletes every node of the fine-grained singly linked list whose data is equivalent to the provided data.
+ *
+ * The matching nodes are found like in `find_node_data_in_fine_grained_list`. Each of them is locked before it
+ * is unlinked, so that no thread still holds it when its data and the node itself are freed.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list from which nodes will be deleted.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_node_from_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Returns the number of nodes in the fine-grained singly linked list.
+ *
+ * The value is exact when no other thread is modifying the list, and a recent snapshot otherwise.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_fine_grained_singly_linked_list_length(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list);
+
+/**
+ * \brief Frees all the nodes of the fine-grained singly linked list.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty and the mutex of its sentinel
+ * is destroyed, so it can only be released with `free`.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list to be freed.
+ */
+void free_fine_grained_singly_linked_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list);
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def HASH_INDEX_INITIAL_CAPACITY
+ * \brief The number of slots allocated by a new hash index. It must be a power of two.
+ */
+#ifndef HASH_INDEX_INITIAL_CAPACITY
+#define HASH_INDEX_INITIAL_CAPACITY 64
+#endif
+
+/**
+ * \struct HashIndexEntry
+ * \brief A structure representing a slot of a hash index.
+ *
+ * The hash of the node data is cached in the slot so that probing and resizing do not call the hash
+ * function again, and most mismatches are rejected without calling the compare function.
+ */
+typedef struct HashIndexEntry
+{
+  Node *node;       /**< Pointer to the indexed node, or `NULL` if the slot is empty. */
+  size_t node_hash; /**< Hash of the data of the indexed node. */
+} HashIndexEntry;
+
+/**
+ * \struct HashIndex
+ * \brief A structure representing an open-addressing hash table mapping node data to nodes.
+ *
+ * The table uses linear probing and backward-shift deletion, so it never holds tombstones. It is grown
+ * to twice its capacity whenever it would become more than half full. Nodes whose data compare equal
+ * are all indexed, each in its own slot.
+ */
+typedef struct HashIndex
+{
+  HashIndexEntry *entries;                   /**< The slots of the table. */
+  size_t capacity;                           /**< Number of slots, always a power of two. */
+  size_t count;                              /**< Number of slots in use. */
+  HashDataFunction hash_data_function;       /**< Function pointer for hashing node data. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing node data. */
+} HashIndex;
+
+/**
+ * \brief Creates a new empty hash index.
+ *
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ * \param compare_data_function A function pointer used to compare node data. This cannot be `NULL`.
+ *
+ * \return A pointer to the newly created `HashIndex` if successful, or `NULL` if an error occurs.
+ */
+HashIndex *create_hash_index(HashDataFunction hash_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Adds a node to the hash index, growing the table if needed.
+ *
+ * \param hash_index A pointer to the `HashIndex` where the node will be added.
+ * \param node A pointer to the node to be indexed.
+ *
+ * \return true if the node was added, false if the table could not be grown.
+ */
+bool insert_node_into_hash_index(HashIndex *hash_index, Node *node);
+
+/**
+ * \brief Removes a node from the hash index.
+ *
+ * The data of the node must still be valid, since it is hashed to locate the slot of the node.
+ *
+ * \param hash_index A pointer to the `HashIndex` from which the node will be removed.
+ * \param node A pointer to the node to be removed.
+ *
+ * \return true if the node was found and removed, false otherwise.
+ */
+bool remove_node_from_hash_index(HashIndex *hash_index, Node *node);
+
+/**
+ * \brief Searches the hash index for a node whose data matches the provided data.
+ *
+ * \param hash_index A pointer to the `HashIndex` to search in.
+ * \param node_data The data to search for.
+ *
+ * \return A pointer to one of the nodes with matching data, or `NULL` if there is none.
+ */
+Node *find_node_in_hash_index(HashIndex *hash_index, NodeData node_data);
+
+/**
+ * \brief Counts the indexed nodes whose data matches the provided data.
+ *
+ * \param hash_index A pointer to the `HashIndex` to search in.
+ * \param node_data The data to search for.
+ *
+ * \return The number of nodes with matching data.
+ */
+size_t count_nodes_in_hash_index(HashIndex *hash_index, NodeData node_data);
+
+/**
+ * \brief Removes every node from the hash index without shrinking it.
+ *
+ * \param hash_index A pointer to the `HashIndex` to be cleared.
+ */
+void clear_hash_index(HashIndex *hash_index);
+
+/**
+ * \brief Frees the hash index and its table. The indexed nodes are not touched.
+ *
+ * \param hash_index A pointer to the `HashIndex` to be freed.
+ */
+void free_hash_index(HashIndex *hash_index);
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef HAZARD_POINTER_H
+#define HAZARD_POINTER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \def HAZARD_POINTER_MAX_RECORDS
+ * \brief The maximum number of threads that can hold a hazard pointer record of a domain at the same time.
+ */
+#ifndef HAZARD_POINTER_MAX_RECORDS
+#define HAZARD_POINTER_MAX_RECORDS 128
+#endif
+
+/**
+ * \def HAZARD_POINTERS_PER_RECORD
+ * \brief The number of pointers a single thread can protect at the same time.
+ */
+#ifndef HAZARD_POINTERS_PER_RECORD
+#define HAZARD_POINTERS_PER_RECORD 2
+#endif
+
+/**
+ * \def HAZARD_POINTER_RETIRE_THRESHOLD
+ * \brief The number of retired pointers a record accumulates before it scans the domain to reclaim them.
+ *
+ * It is twice the number of hazard pointers of a domain, so that every scan reclaims at least half of them.
+ */
+#ifndef HAZARD_POINTER_RETIRE_THRESHOLD
+#define HAZARD_POINTER_RETIRE_THRESHOLD (2 * HAZARD_POINTER_MAX_RECORDS * HAZARD_POINTERS_PER_RECORD)
+#endif
+
+/**
+ * \def HAZARD_POINTER_CACHE_LINE_SIZE
+ * \brief The alignment of every hazard pointer record, so that threads publishing hazard pointers do not write
+ * to the same cache line. The structures that embed a domain are allocated with this alignment.
+ */
+#ifndef HAZARD_POINTER_CACHE_LINE_SIZE
+#define HAZARD_POINTER_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * \typedef void (*ReclaimFunction)(void *)
+ * \brief A function pointer type for a function that releases a retired pointer.
+ */
+typedef void (*ReclaimFunction)(void *);
+
+/**
+ * \struct HazardPointerRecord
+ * \brief A structure representing the hazard pointers and the retired pointers of one thread.
+ *
+ * A record is owned by a single thread between `acquire_hazard_pointer_record` and
+ * `release_hazard_pointer_record`. Its hazard pointers are read by every thread that scans the domain,
+ * while its retired pointers are only ever touched by the owning thread. The array of retired pointers
+ * holds `HAZARD_POINTER_RETIRE_THRESHOLD` entries and is allocated on the first retirement.
+ */
+typedef struct HazardPointerRecord
+{
+  _Alignas(HAZARD_POINTER_CACHE_LINE_SIZE) _Atomic(void *) hazard_pointers[HAZARD_POINTERS_PER_RECORD]; /**< Pointers the owning thread is currently accessing. */
+  atomic_bool is_active;                                                                                /**< Whether the record is owned by a thread. */
+  void **retired_pointers;                                                                              /**< Pointers unlinked by the owning thread and awaiting reclamation. */
+  size_t retired_count;                                                                                 /**< Number of entries of `retired_pointers` in use. */
+} HazardPointerRecord;
+
+/**
+ * \struct HazardPointerDomain
+ * \brief A structure representing a set of hazard pointer records that protect the same kind of objects.
+ *
+ * A pointer retired in a domain is only released with `reclaim_function` once no record of that domain
+ * holds it as a hazard pointer.
+ */
+typedef struct HazardPointerDomain
+{
+  HazardPointerRecord records[HAZARD_POINTER_MAX_RECORDS]; /**< The records of the domain. */
+  ReclaimFunction reclaim_function;                        /**< Function pointer for releasing retired pointers. */
+} HazardPointerDomain;
+
+/**
+ * \brief Initializes a hazard pointer domain.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to be initialized.
+ * \param reclaim_function A function pointer used to release retired pointers. This cannot be `NULL`.
+ */
+void initialize_hazard_pointer_domain(HazardPointerDomain *hazard_pointer_domain, ReclaimFunction reclaim_function);
+
+/**
+ * \brief Releases every pointer still retired in the domain and the memory used by its records.
+ *
+ * No thread may be using the domain while it is destroyed.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to be destroyed.
+ */
+void destroy_hazard_pointer_domain(HazardPointerDomain *hazard_pointer_domain);
+
+/**
+ * \brief Acquires an unused record of the domain for the calling thread.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to acquire the record from.
+ *
+ * \return A pointer to the acquired record, or `NULL` if all `HAZARD_POINTER_MAX_RECORDS` records are in use.
+ */
+HazardPointerRecord *acquire_hazard_pointer_record(HazardPointerDomain *hazard_pointer_domain);
+
+/**
+ * \brief Clears the hazard pointers of a record and gives it back to the domain.
+ *
+ * The pointers retired through the record stay in it and are reclaimed by its next owner or when the
+ * domain is destroyed.
+ *
+ * \param hazard_pointer_record A pointer to the record to be released.
+ */
+void release_hazard_pointer_record(HazardPointerRecord *hazard_pointer_record);
+
+/**
+ * \brief Publishes a pointer that the owning thread is about to access.
+ *
+ * The caller must check that the pointer is still reachable after publishing it, since it may have been
+ * retired in between.
+ *
+ * \param hazard_pointer_record A pointer to the record of the calling thread.
+ * \param hazard_pointer_index The index of the hazard pointer to set, below `HAZARD_POINTERS_PER_RECORD`.
+ * \param pointer The pointer to protect, or `NULL` to clear the hazard pointer.
+ */
+void set_hazard_pointer(HazardPointerRecord *hazard_pointer_record, size_t hazard_pointer_index, void *pointer);
+
+/**
+ * \brief Retires a pointer that is no longer reachable from the shared structure.
+ *
+ * The pointer is released with the `reclaim_function` of the domain once no record holds it as a hazard
+ * pointer. Every `HAZARD_POINTER_RETIRE_THRESHOLD` retirements the record scans the domain and releases
+ * every pointer that is no longer protected. If the array of retired pointers of the record cannot be
+ * allocated, the function waits until no record protects the pointer and releases it itself.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` the record belongs to.
+ * \param hazard_pointer_record A pointer to the record of the calling thread.
+ * \param pointer The pointer to be retired.
+ */
+void retire_hazard_pointer(HazardPointerDomain *hazard_pointer_domain, HazardPointerRecord *hazard_pointer_record, void *pointer);
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef INLINE_SINGLY_LINKED_LIST_H
+#define INLINE_SINGLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \struct InlineNode
+ * \brief A structure representing a node of an inline singly linked list, with its payload stored in the node itself.
+ *
+ * The payload follows the `next_node` pointer in the same allocation, so reading it does not load a second
+ * cache line from elsewhere in memory. It is aligned like a pointer, which suits payloads made of integers,
+ * pointers and doubles.
+ */
+typedef struct InlineNode
+{
+  struct InlineNode *next_node; /**< Pointer to the next node in the list. */
+  unsigned char node_data[];    /**< The payload, `element_size` bytes long. */
+} InlineNode;
+
+/**
+ * \struct InlineSinglyLinkedList
+ * \brief A structure representing a singly linked list whose nodes store fixed-size payloads inline.
+ *
+ * Every node holds a copy of an `element_size` byte payload, so each element takes a single allocation. The
+ * function pointers receive a pointer to the payload inside the node, passed as `NodeData`.
+ */
+typedef struct InlineSinglyLinkedList
+{
+  InlineNode *head_node;                     /**< Pointer to the first node in the list. */
+  InlineNode *tail_node;                     /**< Pointer to the last node in the list. */
+  size_t length;                             /**< Number of nodes currently in the list. */
+  size_t element_size;                       /**< Size in bytes of the payload of every node. */
+  PrintDataFunction print_data_function;     /**< Function pointer for printing a payload. */
+  FreeDataFunction free_data_function;       /**< Function pointer for releasing the resources owned by a payload, or `NULL`. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing a payload with a key. */
+} InlineSinglyLinkedList;
+
+/**
+ * \brief Creates a new inline singly linked list for payloads of the provided size.
+ *
+ * This function allocates memory for a new `InlineSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing payloads. If `element_size` is 0, the
+ * print or compare function pointer is NULL or the allocation fails, an error is reported and the function
+ * returns `NULL`.
+ *
+ * \param element_size The size in bytes of every payload stored in the list.
+ * \param print_data_function A function pointer used to print a payload.
+ * \param free_data_function A function pointer used to release the resources owned by a payload before its node is
+ * freed. It must not free the payload itself, and may be `NULL` for payloads that do not own any resources.
+ * \param compare_data_function A function pointer used to compare a payload with the key passed to find and delete.
+ *
+ * \return A pointer to the newly created `InlineSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+InlineSinglyLinkedList *create_inline_singly_linked_list(size_t element_size, PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Inserts a copy of a payload at the head of the inline singly linked list.
+ *
+ * The node and the payload are allocated together and `element_size` bytes are copied from `element`.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` where the payload will be inserted.
+ * \param element A pointer to the payload to be copied. This cannot be `NULL`.
+ */
+void insert_element_at_inline_singly_linked_list_head(InlineSinglyLinkedList *inline_singly_linked_list, const void *element);
+
+/**
+ * \brief Inserts a copy of a payload at the tail of the inline singly linked list.
+ *
+ * The node and the payload are allocated together and `element_size` bytes are copied from `element`.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` where the payload will be inserted.
+ * \param element A pointer to the payload to be copied. This cannot be `NULL`.
+ */
+void insert_element_at_inline_singly_linked_list_tail(InlineSinglyLinkedList *inline_singly_linked_list, const void *element);
+
+/**
+ * \brief Prints all the payloads in the inline singly linked list, from head to tail.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be printed.
+ */
+void print_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list);
+
+/**
+ * \brief Frees all the nodes in the inline singly linked list and leaves it empty.
+ *
+ * The `free_data_function` of the list, if any, is called on every payload before its node is freed.
+ * The list structure itself is not freed.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be freed.
+ */
+void free_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list);
+
+/**
+ * \brief Returns the number of nodes in the inline singly linked list in constant time.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_inline_singly_linked_list_length(InlineSinglyLinkedList *inline_singly_linked_list);
+
+/**
+ * \brief Reverses the order of the nodes in the inline singly linked list.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be reversed.
+ */
+void reverse_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list);
+
+/**
+ * \brief Searches for the first node of the inline singly linked list whose payload matches the provided key.
+ *
+ * The compare function of the list is called with a pointer to the payload inside every node and the key,
+ * so no pointer to the payload has to be loaded.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to search in.
+ * \param key The key to search for.
+ *
+ * \return A pointer to the matching node, or `NULL` if no node is found.
+ */
+InlineNode *find_node_in_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list, NodeData key);
+
+/**
+ * \brief Checks if an inline singly linked list is valid.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be checked.
+ *
+ * \return true if the inline singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list);
+
+/**
+ * \brief Deletes every node of the inline singly linked list whose payload matches the provided key.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` from which nodes will be deleted.
+ * \param key The key to search for. Nodes whose payload matches it will be deleted.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_elements_from_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list, NodeData key);
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef INTRUSIVE_SINGLY_LINKED_LIST_H
+#define INTRUSIVE_SINGLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def INTRUSIVE_CONTAINER_OF(link, type, member)
+ * \brief Returns a pointer to the `type` object whose `member` field is the `IntrusiveLink` pointed to by `link`.
+ *
+ * \param link A pointer to the embedded `IntrusiveLink`.
+ * \param type The type of the object embedding the link.
+ * \param member The name of the `IntrusiveLink` field of `type`.
+ */
+#define INTRUSIVE_CONTAINER_OF(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * \struct IntrusiveLink
+ * \brief A structure representing the link that user objects embed to be stored in an intrusive singly linked list.
+ *
+ * The link is owned by the object embedding it, so inserting the object into a list does not allocate anything.
+ * An object can be in as many lists at once as it has links.
+ */
+typedef struct IntrusiveLink
+{
+  struct IntrusiveLink *next_link; /**< Pointer to the link of the next element in the list. */
+} IntrusiveLink;
+
+/**
+ * \struct IntrusiveSinglyLinkedList
+ * \brief A structure representing a singly linked list of user objects that embed their own link.
+ *
+ * Every element is a user object holding an `IntrusiveLink` at `link_offset` bytes from its start. The list
+ * converts between links and elements with that offset, so the function pointers receive the elements themselves,
+ * as `NodeData`, and reaching an element from its link does not load any pointer.
+ */
+typedef struct IntrusiveSinglyLinkedList
+{
+  IntrusiveLink *head_link;                  /**< Pointer to the link of the first element in the list. */
+  IntrusiveLink *tail_link;                  /**< Pointer to the link of the last element in the list. */
+  size_t length;                             /**< Number of elements currently in the list. */
+  size_t link_offset;                        /**< Offset of the `IntrusiveLink` inside every element, as given by `offsetof`. */
+  PrintDataFunction print_data_function;     /**< Function pointer for printing an element. */
+  FreeDataFunction free_data_function;       /**< Function pointer for freeing an element, including its link. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing an element with a key. */
+} IntrusiveSinglyLinkedList;
+
+/**
+ * \brief Creates a new intrusive singly linked list with the provided link offset and function pointers.
+ *
+ * This function allocates memory for a new `IntrusiveSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing elements. If any of the function
+ * pointers is NULL or the allocation fails, an error is reported and the function returns `NULL`.
+ *
+ * \param link_offset The offset of the `IntrusiveLink` inside the elements, usually `offsetof(type, member)`.
+ * \param print_data_function A function pointer used to print an element.
+ * \param free_data_function A function pointer used to free an element.
+ * \param compare_data_function A function pointer used to compare an element with the key passed to find and delete.
+ *
+ * \return A pointer to the newly created `IntrusiveSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+IntrusiveSinglyLinkedList *create_intrusive_singly_linked_list(size_t link_offset, PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Inserts an element at the head of the intrusive singly linked list.
+ *
+ * The element is linked through its embedded link, so nothing is allocated. The link must not be in use by
+ * any other list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` where the element will be inserted.
+ * \param element The element to be inserted. This cannot be `NULL`.
+ */
+void insert_element_at_intrusive_singly_linked_list_head(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element);
+
+/**
+ * \brief Inserts an element at the tail of the intrusive singly linked list.
+ *
+ * The element is linked through its embedded link, so nothing is allocated. The link must not be in use by
+ * any other list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` where the element will be inserted.
+ * \param element The element to be inserted. This cannot be `NULL`.
+ */
+void insert_element_at_intrusive_singly_linked_list_tail(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element);
+
+/**
+ * \brief Prints all the elements in the intrusive singly linked list, from head to tail.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be printed.
+ */
+void print_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list);
+
+/**
+ * \brief Frees all the elements in the intrusive singly linked list and leaves it empty.
+ *
+ * Every element is passed to the `free_data_function` of the list, which releases the element together with
+ * its embedded link. The list structure itself is not freed.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be freed.
+ */
+void free_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list);
+
+/**
+ * \brief Returns the number of elements in the intrusive singly linked list in constant time.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of elements in the list, or 0 if the list is invalid.
+ */
+size_t get_intrusive_singly_linked_list_length(IntrusiveSinglyLinkedList *intrusive_singly_linked_list);
+
+/**
+ * \brief Reverses the order of the elements in the intrusive singly linked list by relinking their links.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be reversed.
+ */
+void reverse_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list);
+
+/**
+ * \brief Searches for the first element in the intrusive singly linked list that matches the provided key.
+ *
+ * The compare function of the list is called with every element and the key until it returns true.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to search in.
+ * \param key The key to search for.
+ *
+ * \return A pointer to the matching element, or `NULL` if no element is found.
+ */
+NodeData find_element_in_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData key);
+
+/**
+ * \brief Checks if an intrusive singly linked list is valid.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be checked.
+ *
+ * \return true if the intrusive singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list);
+
+/**
+ * \brief Deletes every element of the intrusive singly linked list that matches the provided key.
+ *
+ * The matching elements are unlinked and passed to the `free_data_function` of the list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` from which elements will be deleted.
+ * \param key The key to search for. Elements matching it will be deleted.
+ *
+ * \return The number of elements that were deleted from the list.
+ */
+size_t delete_elements_from_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData key);
+
+/**
+ * \brief Unlinks a specific element from the intrusive singly linked list without freeing it.
+ *
+ * The element is identified by its address rather than by comparison, and is handed back to the caller, who
+ * may insert it into another list or free it.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` from which the element will be removed.
+ * \param element The element to be removed. This cannot be `NULL`.
+ *
+ * \return true if the element was found and unlinked, false otherwise.
+ */
+bool remove_element_from_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element);
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+/**
+ * \def NODE_POOL_SLAB_CAPACITY
+ * \brief The number of nodes carved out of every slab allocated by a node pool.
+ *
+ * Larger slabs mean fewer calls to `malloc` and better locality between consecutive inserts, at the cost
+ * of up to one partially used slab per list. It can be overridden at compile time.
+ */
+#ifndef NODE_POOL_SLAB_CAPACITY
+#define NODE_POOL_SLAB_CAPACITY 1024
+#endif
+
+struct Node;
+struct NodeSlab;
+
+/**
+ * \struct NodePool
+ * \brief A structure representing a per-list pool of nodes carved out of large slabs.
+ *
+ * Nodes are handed out sequentially from the most recently allocated slab. Nodes released back to the pool
+ * are kept in a free list, linked through their own `next_node` pointer, and are reused before any new slab
+ * is requested. All slabs are returned to the system at once when the pool is destroyed.
+ *
+ * When the nodes of a list are split between two lists, their pools join a sharing group, a ring of pools whose
+ * slabs may hold each other's nodes. Destroying a pool of a group hands its slabs over to another member instead
+ * of freeing them, so the slabs are only returned to the system with the last pool of the group. Since the members
+ * point to each other, a shared pool must only be moved with `move_node_pool`.
+ */
+typedef struct NodePool
+{
+  struct NodeSlab *slab_list;             /**< Pointer to the slab nodes are currently handed out from, which links to the other ones. */
+  struct NodeSlab *last_slab;             /**< Pointer to the last slab of the slab list, or `NULL` if there is none. */
+  struct Node *free_node_list;            /**< Pointer to the first node released back to the pool, or `NULL` if there is none. */
+  struct Node *last_free_node;            /**< Pointer to the last node of the free node list, meaningful only when the list is not empty. */
+  struct NodePool *next_sharing_pool;     /**< Next pool of the sharing group of the pool, or `NULL` if the pool is not shared. */
+  struct NodePool *previous_sharing_pool; /**< Previous pool of the sharing group of the pool, or `NULL` if the pool is not shared. */
+} NodePool;
+
+/**
+ * \brief Initializes an empty node pool.
+ *
+ * This function sets the slab list and the free node list of the pool to `NULL` and leaves it out of any
+ * sharing group. No memory is allocated until the first node is requested.
+ *
+ * \param node_pool A pointer to the `NodePool` to be initialized.
+ */
+void initialize_node_pool(NodePool *node_pool);
+
+/**
+ * \brief Allocates a node from the node pool.
+ *
+ * This function first reuses a node from the free node list if there is one. Otherwise it hands out the next
+ * unused node of the current slab, allocating a new slab of `NODE_POOL_SLAB_CAPACITY` nodes when the current
+ * one is exhausted. The returned node is not initialized.
+ *
+ * \param node_pool A pointer to the `NodePool` to allocate the node from.
+ *
+ * \return A pointer to the allocated node, or `NULL` if a new slab could not be allocated.
+ */
+struct Node *allocate_node_from_pool(NodePool *node_pool);
+
+/**
+ * \brief Allocates a contiguous run of nodes from the node pool.
+ *
+ * If the current slab has enough unused nodes left, the run is carved out of it. Otherwise a dedicated
+ * slab of exactly `node_count` nodes is allocated for the run, leaving the current slab in place for
+ * later single-node allocations. The free node list is never used, since its nodes are not contiguous.
+ * The returned nodes are not initialized, and each of them can later be released individually.
+ *
+ * \param node_pool A pointer to the `NodePool` to allocate the nodes from.
+ * \param node_count The number of nodes to allocate. This must be greater than 0.
+ *
+ * \return A pointer to the first node of the run, or `NULL` if a new slab could not be allocated.
+ */
+struct Node *allocate_node_run_from_pool(NodePool *node_pool, size_t node_count);
+
+/**
+ * \brief Releases a node back to the node pool.
+ *
+ * This function pushes the node onto the free node list of the pool so that it can be reused by a later
+ * allocation. The node must have been allocated from the same pool.
+ *
+ * \param node_pool A pointer to the `NodePool` that owns the node.
+ * \param node A pointer to the node to be released.
+ */
+void release_node_to_pool(NodePool *node_pool, struct Node *node);
+
+/**
+ * \brief Releases a chain of nodes back to the node pool at once.
+ *
+ * This function links the last node of the chain to the free node list of the pool and makes the first node its
+ * new head, so releasing the chain takes constant time whatever its length. The nodes must be linked from
+ * `first_node` to `last_node` through their `next_node` pointers and must have been allocated from the same pool.
+ *
+ * \param node_pool A pointer to the `NodePool` that owns the nodes.
+ * \param first_node A pointer to the first node of the chain.
+ * \param last_node A pointer to the last node of the chain.
+ */
+void release_node_chain_to_pool(NodePool *node_pool, struct Node *first_node, struct Node *last_node);
+
+/**
+ * \brief Moves every slab and free node of a node pool into another one.
+ *
+ * The slabs of the source pool are linked after the current slab of the destination pool, which keeps handing
+ * out nodes, and the free node list of the source pool is prepended to the one of the destination pool, in
+ * constant time. Every node allocated from either pool stays valid and is owned by the destination pool
+ * afterwards, and the source pool is left empty. If the source pool was shared, the destination pool takes its
+ * place in its sharing group, which takes time proportional to the size of the groups involved.
+ *
+ * \param destination_node_pool A pointer to the `NodePool` that takes over the slabs and free nodes.
+ * \param source_node_pool A pointer to the `NodePool` to be emptied. It must not be the destination pool.
+ */
+void merge_node_pools(NodePool *destination_node_pool, NodePool *source_node_pool);
+
+/**
+ * \brief Puts two node pools in the same sharing group.
+ *
+ * After this call, nodes allocated from either pool may be handed over to the list of the other one, and the
+ * slabs of both pools are only returned to the system once every pool of the group has been destroyed. If the
+ * pools are already in different groups, the groups are joined. This takes time proportional to the size of the
+ * group of `node_pool`.
+ *
+ * \param node_pool A pointer to the first `NodePool`.
+ * \param other_node_pool A pointer to the second `NodePool`. It must not be the first pool.
+ */
+void share_node_pools(NodePool *node_pool, NodePool *other_node_pool);
+
+/**
+ * \brief Moves a node pool to another location, keeping its sharing group pointing to it.
+ *
+ * \param destination_node_pool A pointer to the uninitialized or empty and unshared `NodePool` that takes the place of the source pool.
+ * \param source_node_pool A pointer to the `NodePool` to be moved. It is left empty and unshared.
+ */
+void move_node_pool(NodePool *destination_node_pool, NodePool *source_node_pool);
+
+/**
+ * \brief Destroys a node pool, returning all of its slabs at once.
+ *
+ * This function frees every slab owned by the pool, which invalidates every node allocated from it, and
+ * leaves the pool empty and ready to be used again. If the pool is shared, its slabs may still hold nodes of
+ * the other pools of its group, so they are handed over to one of them instead and the pool leaves the group.
+ *
+ * \param node_pool A pointer to the `NodePool` to be destroyed.
+ */
+void destroy_node_pool(NodePool *node_pool);
+
+#endif
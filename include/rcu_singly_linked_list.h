@@ -0,0 +1,188 @@
+#ifndef RCU_SINGLY_LINKED_LIST_H
+#define RCU_SINGLY_LINKED_LIST_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "epoch_reclamation.h"
+#include "singly_linked_list.h"
+
+/**
+ * \struct RcuNode
+ * \brief A structure representing a node of a read-copy-update singly linked list.
+ *
+ * The `node_data` and `next_node` fields are the only ones readers access. The `free_data_function` is
+ * set by the writer that unlinks the node, and is called on `node_data` once the node is reclaimed. A node
+ * allocated with `malloc` uses the same amount of memory with or without this third pointer.
+ */
+typedef struct RcuNode
+{
+  NodeData node_data;                  /**< Pointer to the data stored in the node. */
+  _Atomic(struct RcuNode *) next_node; /**< Pointer to the next node in the list. */
+  FreeDataFunction free_data_function; /**< Function pointer for freeing the data of the node once it is reclaimed, or `NULL`. */
+} RcuNode;
+
+/**
+ * \struct RcuSinglyLinkedList
+ * \brief A structure representing a read-mostly singly linked list whose readers never take a lock.
+ *
+ * Readers traverse the list inside an epoch critical section, following `head_node` and `next_node` with
+ * acquire loads, and never write to memory shared with other threads. Writers serialize on `writer_mutex`,
+ * fully initialize every new node before publishing it with a release store, and retire every node they
+ * unlink in `epoch_domain`, so that it is only freed after a grace period, once every reader that could
+ * still be traversing it has left its critical section.
+ */
+typedef struct RcuSinglyLinkedList
+{
+  _Atomic(RcuNode *) head_node;              /**< Pointer to the first node in the list. */
+  atomic_size_t length;                      /**< Number of nodes currently in the list. */
+  pthread_mutex_t writer_mutex;              /**< Mutex serializing the threads modifying the list. */
+  FreeDataFunction free_data_function;       /**< Function pointer for freeing node data. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing node data. */
+  EpochDomain epoch_domain;                  /**< Domain deferring the reclamation of the nodes unlinked from the list. */
+} RcuSinglyLinkedList;
+
+/**
+ * \brief Creates a new read-copy-update singly linked list.
+ *
+ * This function allocates memory for a new `RcuSinglyLinkedList`, initializes its writer mutex and its
+ * epoch domain. If a function pointer is NULL or an allocation fails, an error message is printed and the
+ * function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ *
+ * \return A pointer to the newly created `RcuSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+RcuSinglyLinkedList *create_rcu_singly_linked_list(FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Registers the calling thread with a read-copy-update singly linked list.
+ *
+ * Every thread that reads or modifies the list needs its own epoch record, which it passes to the other
+ * functions of the list and gives back with `unregister_rcu_singly_linked_list_thread`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list the thread will use.
+ *
+ * \return A pointer to the epoch record of the thread, or `NULL` if none is available.
+ */
+EpochRecord *register_rcu_singly_linked_list_thread(RcuSinglyLinkedList *rcu_singly_linked_list);
+
+/**
+ * \brief Gives back the epoch record of a thread that no longer uses the list.
+ *
+ * \param epoch_record A pointer to the record returned by `register_rcu_singly_linked_list_thread`.
+ */
+void unregister_rcu_singly_linked_list_thread(EpochRecord *epoch_record);
+
+/**
+ * \brief Enters a read-side critical section of the list.
+ *
+ * The data returned by `find_node_data_in_rcu_list` stays valid until the matching call to
+ * `exit_rcu_read_section`, even if a writer deletes or replaces it in the meantime. Read sections can be nested.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be read.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void enter_rcu_read_section(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record);
+
+/**
+ * \brief Leaves a read-side critical section entered with `enter_rcu_read_section`.
+ *
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void exit_rcu_read_section(EpochRecord *epoch_record);
+
+/**
+ * \brief Finds the data of the first node matching a key without taking any lock.
+ *
+ * This function traverses the list with acquire loads inside its own read section, so it can run at the
+ * same time as writers. The returned data may be reclaimed as soon as the read section ends, so a caller
+ * that uses it must wrap the call and every use of the data in `enter_rcu_read_section` and `exit_rcu_read_section`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be searched.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ *
+ * \return The data of the first matching node, or `NULL` if no node matches or an error occurs.
+ */
+NodeData find_node_data_in_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key);
+
+/**
+ * \brief Inserts a new node at the head of the read-copy-update singly linked list.
+ *
+ * The node is fully initialized before it is published with a release store, so a reader that reaches
+ * it always sees its data.
+ *
+ * \param rcu_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_at_rcu_head(RcuSinglyLinkedList *rcu_singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Deletes the first node matching a key from the read-copy-update singly linked list.
+ *
+ * The node is unlinked with a release store to the pointer leading to it, so readers that have not reached
+ * it yet skip it while readers already on it can still follow its `next_node`. It is then retired, and the
+ * node and its data are freed after a grace period.
+ *
+ * \param rcu_singly_linked_list A pointer to the list from which the node will be deleted.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ *
+ * \return true if a node was deleted, false if no node matches or an error occurs.
+ */
+bool delete_node_from_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key);
+
+/**
+ * \brief Replaces the data of the first node matching a key with a copy of the node holding new data.
+ *
+ * The copy takes the place of the matching node with a single release store, so every reader sees either
+ * the old data or the new data, never a mix. The old node and its data are freed after a grace period.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be updated.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ * \param new_node_data The data replacing the data of the matching node. This cannot be `NULL`.
+ *
+ * \return true if a node was replaced, false if no node matches or an error occurs, in which case the caller keeps ownership of `new_node_data`.
+ */
+bool replace_node_data_in_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key, NodeData new_node_data);
+
+/**
+ * \brief Waits for a grace period, then reclaims the nodes retired by the calling thread.
+ *
+ * When this function returns, every reader that was inside a read section when it was called has left it.
+ * The calling thread must not be inside a read section itself, since it would wait for itself forever.
+ *
+ * \param rcu_singly_linked_list A pointer to the list whose grace period is awaited.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void synchronize_rcu_singly_linked_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record);
+
+/**
+ * \brief Returns the number of nodes in the read-copy-update singly linked list.
+ *
+ * The value is exact when no writer is modifying the list, and a recent snapshot otherwise.
+ *
+ * \param rcu_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_rcu_singly_linked_list_length(RcuSinglyLinkedList *rcu_singly_linked_list);
+
+/**
+ * \brief Frees all the nodes of the read-copy-update singly linked list and every node still retired.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty and its writer mutex is
+ * destroyed, so it can only be released with `free`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be freed.
+ */
+void free_rcu_singly_linked_list(RcuSinglyLinkedList *rcu_singly_linked_list);
+
+#endif
@@ -2,6 +2,44 @@
 #define SINGLY_LINKED_LIST_H
 
 #include <stdbool.h>
+#include <stddef.h>
+
+#include "node_pool.h"
+#include "singly_linked_list_status.h"
+
+/**
+ * \def SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE
+ * \brief The number of nodes ahead of the current one that the traversals of a new list prefetch.
+ *
+ * While a traversal visits a node, the node this many positions ahead and its data are prefetched, so their
+ * cache misses overlap with the work done on the nodes in between. It can be overridden at compile time, and
+ * changed for every list with `set_prefetch_distance`.
+ */
+#ifndef SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE
+#define SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE 4
+#endif
+
+/**
+ * \def FIND_NODES_BATCH_LINEAR_KEY_LIMIT
+ * \brief The largest batch of keys `find_nodes_by_data_batch` compares against every node one by one.
+ *
+ * Larger batches are looked up in a temporary hash set of the keys when a hash function is provided, so every
+ * node costs one hash and one probe instead of one comparison per key. It can be overridden at compile time.
+ */
+#ifndef FIND_NODES_BATCH_LINEAR_KEY_LIMIT
+#define FIND_NODES_BATCH_LINEAR_KEY_LIMIT 16
+#endif
+
+/**
+ * \def DELETE_NODES_FREE_BATCH_SIZE
+ * \brief The largest number of pieces of node data `delete_nodes_if` passes to the batch free function of a list at once.
+ *
+ * The data of the deleted nodes is gathered into an array of this many entries on the stack before every call.
+ * It can be overridden at compile time.
+ */
+#ifndef DELETE_NODES_FREE_BATCH_SIZE
+#define DELETE_NODES_FREE_BATCH_SIZE 256
+#endif
 
 /**
  * \typedef void* NodeData
@@ -37,6 +75,46 @@ typedef void (*FreeDataFunction)(NodeData);
  */
 typedef bool (*CompareDataFunction)(NodeData, NodeData);
 
+/**
+ * \typedef size_t (*HashDataFunction)(NodeData)
+ * \brief A function pointer type for a function that hashes the data of a node.
+ *
+ * This typedef represents a function pointer for a function that takes `NodeData` as an argument and returns a `size_t` hash.
+ * Two pieces of data that compare equal with the `CompareDataFunction` of the list must have the same hash.
+ */
+typedef size_t (*HashDataFunction)(NodeData);
+
+/**
+ * \typedef int (*OrderDataFunction)(NodeData, NodeData)
+ * \brief A function pointer type for a function that orders two pieces of node data.
+ *
+ * This typedef represents a function pointer for a function that takes two `NodeData` pointers as arguments and returns a negative value if the first one
+ * goes before the second one, 0 if they are equivalent, and a positive value if the first one goes after the second one, like the comparator of `qsort`.
+ */
+typedef int (*OrderDataFunction)(NodeData, NodeData);
+
+/**
+ * \typedef void (*FreeDataBatchFunction)(NodeData *, size_t)
+ * \brief A function pointer type for a function that frees the data of several nodes at once.
+ *
+ * This typedef represents a function pointer for a function that takes an array of `NodeData` and its length and returns nothing (`void`).
+ * It must free every piece of data of the array, as the `FreeDataFunction` of the list would one at a time, and lets the
+ * cost of releasing memory, such as taking the lock of an allocator, be paid once per batch.
+ */
+typedef void (*FreeDataBatchFunction)(NodeData *, size_t);
+
+/**
+ * \typedef bool (*NodePredicateFunction)(NodeData, void *)
+ * \brief A function pointer type for a function that decides whether the data of a node satisfies a condition.
+ *
+ * This typedef represents a function pointer for a function that takes `NodeData` and a caller-provided context pointer as arguments
+ * and returns `true` if the data satisfies the condition, `false` otherwise.
+ */
+typedef bool (*NodePredicateFunction)(NodeData, void *);
+
+struct HashIndex;
+struct SkipListIndex;
+
 /**
  * \struct Node
  * \brief A structure representing a node in a singly linked list.
@@ -56,14 +134,29 @@ typedef struct Node
  *
  * This structure represents a singly singly linked list with a pointer to the head node, a pointer to the tail node, and function pointers for specific operations on the data.
  * The list can store data of any type, and operations like printing, freeing, and comparing data can be customized by providing the appropriate function pointers.
+ * The nodes of the list are allocated from its own `NodePool`, so inserting does not call `malloc` for every node.
+ * An optional `HashIndex` can be attached to the list to make searching and deleting by data run in expected constant time.
+ * An optional `OrderDataFunction` can be set on the list to sort it, and an optional `SkipListIndex` can be attached to a
+ * sorted list to find, insert and delete nodes in order in expected logarithmic time.
  */
 typedef struct SinglyLinkedList
 {
-  Node *head_node;                           /**< Pointer to the first node in the list. */
-  Node *tail_node;                           /**< Pointer to the last node in the list. */
-  PrintDataFunction print_data_function;     /**< Function pointer for printing node data. */
-  FreeDataFunction free_data_function;       /**< Function pointer for freeing node data. */
-  CompareDataFunction compare_data_function; /**< Function pointer for comparing node data. */
+  Node *head_node;                                /**< Pointer to the first node in the list. */
+  Node *tail_node;                                /**< Pointer to the last node in the list. */
+  size_t length;                                  /**< Number of nodes currently in the list. */
+  PrintDataFunction print_data_function;          /**< Function pointer for printing node data. */
+  FreeDataFunction free_data_function;            /**< Function pointer for freeing node data. */
+  CompareDataFunction compare_data_function;      /**< Function pointer for comparing node data. */
+  OrderDataFunction order_data_function;          /**< Optional function pointer for ordering node data, or `NULL` if there is none. */
+  FreeDataBatchFunction free_data_batch_function; /**< Optional function pointer for freeing the data of several nodes at once, or `NULL` if there is none. */
+  NodePool node_pool;                             /**< Pool the nodes of the list are allocated from. */
+  struct HashIndex *hash_index;                   /**< Optional hash index over the node data, or `NULL` if there is none. */
+  struct SkipListIndex *skip_list_index;          /**< Optional skip list index over the sorted nodes, or `NULL` if there is none. */
+  size_t prefetch_distance;                       /**< Number of nodes ahead of the current one that traversals prefetch, or 0 to disable prefetching. */
+  NodePool compaction_source_pool;                /**< Pool still holding the nodes an incremental compaction in progress has not moved yet. */
+  Node *last_compacted_node;                      /**< Last node moved by the incremental compaction in progress, or `NULL` if it has not moved any yet. */
+  Node *compaction_end_node;                      /**< Last node the incremental compaction in progress has to move, or `NULL` if none is left. */
+  bool is_compacting;                             /**< Whether an incremental compaction of the list is in progress. */
 } SinglyLinkedList;
 
 /**
@@ -72,8 +165,8 @@ typedef struct SinglyLinkedList
  * This function allocates memory for a new `SinglyLinkedList` structure, initializes its fields,
  * and sets the function pointers for printing, freeing, and comparing node data. It performs
  * checks to ensure that none of the function pointers are NULL, and if any are, an error
- * message is printed and the function returns `NULL`. If memory allocation for the singly linked list
- * fails, an error message is also printed.
+ * is reported and the function returns `NULL`. If memory allocation for the singly linked list
+ * fails, an error is also reported.
  *
  * \param print_data_function A function pointer used to print the data of a node.
  * \param free_data_function A function pointer used to free the data of a node.
@@ -83,13 +176,30 @@ typedef struct SinglyLinkedList
  */
 SinglyLinkedList *create_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
 
+/**
+ * \brief Creates a new singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `create_singly_linked_list`, but returns a status instead of `NULL` on failure.
+ *
+ * \param print_data_function A function pointer used to print the data of a node.
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ * \param created_singly_linked_list Where the new list is stored on success. It is set to `NULL` on failure.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be created.
+ */
+SinglyLinkedListStatus try_create_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function, SinglyLinkedList **created_singly_linked_list);
+
 /**
  * \brief Creates a new node with the provided data.
  *
  * This function allocates memory for a new `Node` structure, sets its data to the provided
  * `node_data`, and initializes its `next_node` pointer to `NULL`. It checks if the `node_data`
- * is `NULL` before proceeding, and if so, prints an error message and returns `NULL`. It also
- * checks for memory allocation failure and prints an error message if allocation fails.
+ * is `NULL` before proceeding, and if so, reports an error and returns `NULL`. It also
+ * checks for memory allocation failure and reports an error if allocation fails.
+ *
+ * The node is allocated with `malloc` and is meant to be used outside of a `SinglyLinkedList`; the insert
+ * functions allocate their nodes from the node pool of the list instead.
  *
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  *
@@ -97,6 +207,18 @@ SinglyLinkedList *create_singly_linked_list(PrintDataFunction print_data_functio
  */
 Node *create_node(NodeData node_data);
 
+/**
+ * \brief Creates a new node with the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `create_node`, but returns a status instead of `NULL` on failure.
+ *
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ * \param created_node Where the new node is stored on success. It is set to `NULL` on failure.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be created.
+ */
+SinglyLinkedListStatus try_create_node(NodeData node_data, Node **created_node);
+
 /**
  * \brief Inserts a new node at the head of the singly linked list.
  *
@@ -104,13 +226,25 @@ Node *create_node(NodeData node_data);
  * of the singly linked list. If the singly linked list is empty (i.e., `head_node` is `NULL`), the new node
  * becomes both the head and the tail of the list. If the list already has nodes, the new node
  * is inserted at the front, and the previous head becomes the second node. The function also
- * checks if the node creation fails and prints an error message if necessary.
+ * checks if the node creation fails and reports an error if necessary.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  */
 void insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_data);
 
+/**
+ * \brief Inserts a new node at the head of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_at_head`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
 /**
  * \brief Inserts a new node at the tail of the singly linked list.
  *
@@ -118,13 +252,82 @@ void insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_dat
  * tail of the singly linked list. If the list is empty (i.e., `head_node` is `NULL`), the new node
  * becomes both the head and the tail of the list. If the list already has nodes, the new node
  * is added after the current tail. The function also checks if the node creation fails and
- * prints an error message if necessary.
+ * reports an error if necessary.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  */
 void insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_data);
 
+/**
+ * \brief Inserts a new node at the tail of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_at_tail`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Inserts an array of data at the head of the singly linked list in a single step.
+ *
+ * This function allocates the nodes for all the data as one contiguous block from the node pool of the list,
+ * links them in a single pass, and splices the resulting chain in front of the current head. The resulting
+ * order is the same as calling `insert_node_at_head` once per element of `node_data_array`, so the last
+ * element ends up at the head. If any element is `NULL`, nothing is inserted and an error is reported.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return true if all the nodes were inserted, false if an error occurred and none was inserted.
+ */
+bool insert_nodes_at_head_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count);
+
+/**
+ * \brief Inserts an array of data at the head of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_nodes_at_head_bulk`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_nodes_at_head_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count);
+
+/**
+ * \brief Inserts an array of data at the tail of the singly linked list in a single step.
+ *
+ * This function allocates the nodes for all the data as one contiguous block from the node pool of the list,
+ * links them in array order in a single pass, and splices the resulting chain after the current tail with a
+ * single tail update. If any element is `NULL`, nothing is inserted and an error is reported.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return true if all the nodes were inserted, false if an error occurred and none was inserted.
+ */
+bool insert_nodes_at_tail_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count);
+
+/**
+ * \brief Inserts an array of data at the tail of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_nodes_at_tail_bulk`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_nodes_at_tail_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count);
+
 /**
  * \brief Prints all the nodes in the singly linked list.
  *
@@ -137,50 +340,94 @@ void insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_dat
  */
 void print_singly_linked_list(SinglyLinkedList *singly_linked_list);
 
+/**
+ * \brief Prints all the nodes in the singly linked list and reports the outcome as a status code.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be printed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_print_singly_linked_list(SinglyLinkedList *singly_linked_list);
+
 /**
  * \brief Frees all the nodes in the singly linked list and releases the memory.
  *
  * This function iterates through the singly linked list, starting from the head node, and frees
  * each node’s data using the `free_data_function` provided during the creation of the singly linked list.
- * After freeing the node’s data, it frees the memory allocated for the node itself. The function
- * continues until all nodes are freed. Afterward, it sets the `head_node` and `tail_node` of the
- * singly linked list to `NULL` to indicate that the list is empty.
+ * Once the data of every node has been freed, all the slabs of the node pool of the list are returned
+ * at once instead of freeing the nodes one by one. An attached hash index or skip list index is detached and freed
+ * too. Afterward, it sets the `head_node` and `tail_node` of the singly linked list to `NULL` to indicate that the
+ * list is empty, so the list itself can be released with `free`.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` to be freed.
  */
 void free_singly_linked_list(SinglyLinkedList *singly_linked_list);
 
+/**
+ * \brief Frees all the nodes in the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `free_singly_linked_list`, including for attached indexes.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be freed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_free_singly_linked_list(SinglyLinkedList *singly_linked_list);
+
 /**
  * \brief Returns the length of the singly linked list.
  *
- * This function iterates through the singly linked list starting from the head node and counts
- * the number of nodes until it reaches the end of the list (i.e., when `current_node` becomes `NULL`).
- * It returns the total count of nodes in the list. If the list is empty (i.e., the `head_node` is `NULL`),
- * it returns 0.
+ * This function returns the number of nodes tracked in the `length` field of the singly linked list,
+ * so it runs in constant time. If the list is empty or invalid, it returns 0. Lists holding more than
+ * `INT_MAX` nodes report `INT_MAX`; use `get_linked_list_size` to get the exact count.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` whose length is to be calculated.
  *
- * \return The number of nodes in the singly linked list.
+ * \return The number of nodes in the singly linked list, saturated to `INT_MAX`.
  */
 int get_linked_list_length(SinglyLinkedList *singly_linked_list);
 
+/**
+ * \brief Returns the exact number of nodes in the singly linked list.
+ *
+ * This function returns the `length` field of the singly linked list in constant time. Unlike
+ * `get_linked_list_length`, the count is a `size_t`, so lists holding more than `INT_MAX` nodes
+ * are reported exactly on 64-bit hosts. If the list is invalid, it returns 0.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose size is to be returned.
+ *
+ * \return The number of nodes in the singly linked list.
+ */
+size_t get_linked_list_size(SinglyLinkedList *singly_linked_list);
+
 /**
  * \brief Reverses the order of elements in a singly linked list.
  *
  * This function reverses the `next_node` pointers of each node in a singly linked list,
  * making the first node become the last, the second node become the second-to-last, and so on.
- * It also updates the `head_node` pointer of the singly linked list to point to the new first node after reversal.
+ * It also updates the `head_node` and `tail_node` pointers of the singly linked list to point to the new first and last nodes after reversal.
  *
  * \param singly_linked_list Pointer to the singly linked list to be reversed.
  */
 void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list);
 
+/**
+ * \brief Reverses the order of elements in a singly linked list and reports the outcome as a status code.
+ *
+ * \param singly_linked_list Pointer to the singly linked list to be reversed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be reversed.
+ */
+SinglyLinkedListStatus try_reverse_singly_linked_list(SinglyLinkedList *singly_linked_list);
+
 /**
  * \brief Searches for a node in the singly linked list by its data.
  *
  * This function iterates through the singly linked list and compares the data of each node
  * with the provided `node_data`. If a node with matching data is found, the function
  * returns a pointer to that node. If no match is found or the list is empty, it returns `NULL`.
+ * If a hash index is attached to the list, the node is looked up in the index instead of scanning the
+ * list; when several nodes match, any one of them may be returned.
  *
  * \param singly_linked_list A pointer to the singly linked list to search in.
  * \param node_data The data to search for in the singly linked list.
@@ -189,6 +436,60 @@ void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list);
  */
 Node *find_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data);
 
+/**
+ * \brief Searches for a node in the singly linked list by its data and reports the outcome as a status code.
+ *
+ * This function behaves like `find_node_by_data`. Not finding a matching node is not an error: the function
+ * succeeds and stores `NULL` in `found_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ * \param found_node Where the matching node, or `NULL` if there is none, is stored.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_find_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data, Node **found_node);
+
+/**
+ * \brief Searches the singly linked list for a batch of keys in a single traversal.
+ *
+ * For every key, `found_nodes` receives the first node whose data matches it, or `NULL` if there is none, like
+ * `key_count` calls to `find_node_by_data` would, but the list is traversed once instead of once per key. Batches
+ * of up to `FIND_NODES_BATCH_LINEAR_KEY_LIMIT` keys, or any batch if `hash_data_function` is `NULL`, are compared
+ * against every node one key at a time. Larger batches are put in a temporary hash set built with
+ * `hash_data_function`, which must hash keys and node data alike, so the traversal costs O(n + k) instead of
+ * O(n * k). The hash set calls the compare function of the list with a key as its first argument, so the compare
+ * function must be symmetric, as it must be for a hash index. If the hash set cannot be allocated, the keys are
+ * compared one by one instead. The traversal stops as soon as every key has been found. If a hash index is attached to the list, every key is looked up in it
+ * instead and, when several nodes match, any one of them may be returned.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param keys The data to search for. This can be `NULL` only if `key_count` is 0.
+ * \param key_count The number of keys in `keys`.
+ * \param found_nodes Where the node matching every key, or `NULL`, is stored. It must hold `key_count` pointers.
+ * \param hash_data_function A function pointer used to hash the keys of large batches, or `NULL`.
+ *
+ * \return The number of keys for which a matching node was found.
+ */
+size_t find_nodes_by_data_batch(SinglyLinkedList *singly_linked_list, NodeData *keys, size_t key_count, Node **found_nodes, HashDataFunction hash_data_function);
+
+/**
+ * \brief Searches the singly linked list for a batch of keys in a single traversal and reports the outcome as a status code.
+ *
+ * This function behaves like `find_nodes_by_data_batch`. Not finding a key is not an error: the function succeeds
+ * and stores `NULL` for it in `found_nodes`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param keys The data to search for. This can be `NULL` only if `key_count` is 0.
+ * \param key_count The number of keys in `keys`.
+ * \param found_nodes Where the node matching every key, or `NULL`, is stored. It must hold `key_count` pointers.
+ * \param hash_data_function A function pointer used to hash the keys of large batches, or `NULL`.
+ * \param found_keys_count Where the number of keys for which a matching node was found is stored. This can be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_find_nodes_by_data_batch(SinglyLinkedList *singly_linked_list, NodeData *keys, size_t key_count, Node **found_nodes, HashDataFunction hash_data_function, size_t *found_keys_count);
+
 /**
  * \brief Checks if a singly linked list is valid.
  *
@@ -207,15 +508,336 @@ bool is_valid_singly_linked_list(SinglyLinkedList *singly_linked_list);
  *
  * This function iterates through the singly linked list, comparing the data of each node
  * with the provided `node_data`. If a node with matching data is found, the node is deleted,
- * and its memory is freed. The list is updated accordingly, and the head and tail pointers
+ * its data is freed and the node is returned to the node pool of the list. The list is updated accordingly, and the head and tail pointers
  * are adjusted if necessary. The function will remove all matching nodes, and the number of
- * deleted nodes is returned.
+ * deleted nodes is returned. If a hash index is attached to the list, it is used to count the matching
+ * nodes first, so the function returns immediately when there is none and stops scanning as soon as the
+ * last one has been deleted.
  *
  * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
  * \param node_data The data to search for in the singly linked list. Nodes with matching data will be deleted.
  *
- * \return The number of nodes that were deleted from the list.
+ * \return The number of nodes that were deleted from the list, saturated to `INT_MAX`.
  */
 int delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data);
 
+/**
+ * \brief Deletes nodes from the singly linked list that match the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_node_by_data`, but stores the exact number of deleted nodes.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list. Nodes with matching data will be deleted.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data, size_t *deleted_nodes_count);
+
+/**
+ * \brief Deletes every node of the singly linked list whose data satisfies a predicate, in a single pass.
+ *
+ * This function calls `predicate_function` on the data of every node, from head to tail, with the provided
+ * `context`. Matching nodes are unlinked and gathered into a chain of victims while the attached indexes are
+ * updated, so the list is traversed once whatever the number of matches. Their data is then freed, in list order,
+ * through the `free_data_batch_function` of the list in batches of up to `DELETE_NODES_FREE_BATCH_SIZE` entries,
+ * or through its `free_data_function` one node at a time if it has no batch free function. Finally, the whole
+ * chain is returned to the node pool of the list at once. The predicate must not modify the list.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param predicate_function A function pointer used to decide which nodes are deleted. This cannot be `NULL`.
+ * \param context A pointer passed to every call of `predicate_function`. This can be `NULL`.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_nodes_if(SinglyLinkedList *singly_linked_list, NodePredicateFunction predicate_function, void *context);
+
+/**
+ * \brief Deletes every node of the singly linked list whose data satisfies a predicate and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_nodes_if`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param predicate_function A function pointer used to decide which nodes are deleted. This cannot be `NULL`.
+ * \param context A pointer passed to every call of `predicate_function`. This can be `NULL`.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be deleted.
+ */
+SinglyLinkedListStatus try_delete_nodes_if(SinglyLinkedList *singly_linked_list, NodePredicateFunction predicate_function, void *context, size_t *deleted_nodes_count);
+
+/**
+ * \brief Moves every node of the source singly linked list to the tail of the destination one, in constant time.
+ *
+ * This function links the tail of the destination list to the head of the source list and leaves the source list
+ * empty but valid, like `splice_singly_linked_list_after_node` after the tail of the destination list.
+ *
+ * \param destination_singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param source_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the destination list.
+ *
+ * \return true if the nodes were moved, false if an error occurred and both lists were left untouched.
+ */
+bool concatenate_singly_linked_lists(SinglyLinkedList *destination_singly_linked_list, SinglyLinkedList *source_singly_linked_list);
+
+/**
+ * \brief Moves every node of the source singly linked list to the tail of the destination one and reports the outcome as a status code.
+ *
+ * This function behaves like `concatenate_singly_linked_lists`.
+ *
+ * \param destination_singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param source_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the destination list.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_concatenate_singly_linked_lists(SinglyLinkedList *destination_singly_linked_list, SinglyLinkedList *source_singly_linked_list);
+
+/**
+ * \brief Moves every node of another singly linked list after a node of the singly linked list, in constant time.
+ *
+ * The chain of `other_singly_linked_list` is linked between `node` and its successor without allocating, copying
+ * or freeing anything, and the other list is left empty but valid. The slabs of its node pool are handed over to
+ * the pool of the list, so the moved nodes are freed with the list and their data with its `free_data_function`.
+ * If the list has a hash index, the moved nodes are added to it, which takes time proportional to their number.
+ * Any skip list index attached to the list is detached, and the indexes of the other list are emptied. Incremental
+ * compactions in progress on either list are canceled.
+ *
+ * \param singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param node A pointer to a node of the list after which the nodes are linked, or `NULL` to link them at the head.
+ * \param other_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the list.
+ *
+ * \return true if the nodes were moved, false if an error occurred and both lists were left untouched.
+ */
+bool splice_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList *other_singly_linked_list);
+
+/**
+ * \brief Moves every node of another singly linked list after a node of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `splice_singly_linked_list_after_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param node A pointer to a node of the list after which the nodes are linked, or `NULL` to link them at the head.
+ * \param other_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the list.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_splice_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList *other_singly_linked_list);
+
+/**
+ * \brief Cuts the singly linked list after a node, moving the nodes that follow it to a new list.
+ *
+ * The chain is cut without allocating, copying or freeing any node: the new list is created with the function
+ * pointers, order function, batch free function and prefetch distance of the list, and takes over the nodes after
+ * `node`. The node pools of both lists join a sharing group, so each list can free its own nodes while the slabs
+ * they live in are kept until both lists have been freed. Counting the moved nodes walks the shorter of the two
+ * parts, or the moved part if the list has a hash index, since the moved nodes are removed from it. Any skip list
+ * index attached to the list is detached, and any incremental compaction in progress is canceled. Both lists must
+ * be freed with `free_singly_linked_list` before their structures are released.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be cut.
+ * \param node A pointer to the last node of the list to be kept, or `NULL` to move every node.
+ *
+ * \return A pointer to the new list holding the nodes after `node`, or `NULL` if an error occurred and the list was left untouched.
+ */
+SinglyLinkedList *split_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node);
+
+/**
+ * \brief Cuts the singly linked list after a node and reports the outcome as a status code.
+ *
+ * This function behaves like `split_singly_linked_list_after_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be cut.
+ * \param node A pointer to the last node of the list to be kept, or `NULL` to move every node.
+ * \param split_singly_linked_list Where the new list holding the nodes after `node` is stored on success.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be cut.
+ */
+SinglyLinkedListStatus try_split_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList **split_singly_linked_list);
+
+/**
+ * \brief Attaches a hash index to the singly linked list.
+ *
+ * This function creates a hash index using the provided `hash_data_function` and the compare function of
+ * the list, and indexes every node already in the list. From then on, every insertion and deletion keeps
+ * the index in sync, and `find_node_by_data` and `delete_node_by_data` use it. Any index previously
+ * attached to the list is replaced.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ *
+ * \return true if the index was attached, false if an error occurred.
+ */
+bool attach_hash_index(SinglyLinkedList *singly_linked_list, HashDataFunction hash_data_function);
+
+/**
+ * \brief Attaches a hash index to the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `attach_hash_index`. On failure any previously attached index is kept.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the index could not be attached.
+ */
+SinglyLinkedListStatus try_attach_hash_index(SinglyLinkedList *singly_linked_list, HashDataFunction hash_data_function);
+
+/**
+ * \brief Sets the function used to order the data of the singly linked list.
+ *
+ * The order function is used by the sort functions of the list. It can be changed or removed at any time
+ * by passing another function or `NULL`. Since the list may not be sorted by the new function, any attached
+ * skip list index is detached.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose order function will be set.
+ * \param order_data_function A function pointer used to order node data, or `NULL`.
+ */
+void set_order_data_function(SinglyLinkedList *singly_linked_list, OrderDataFunction order_data_function);
+
+/**
+ * \brief Sets the function used to free the data of several nodes of the singly linked list at once.
+ *
+ * The batch free function is used by `delete_nodes_if` instead of calling the `free_data_function` of the list
+ * on every deleted node. It can be changed or removed at any time by passing another function or `NULL`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose batch free function will be set.
+ * \param free_data_batch_function A function pointer used to free the data of several nodes at once, or `NULL`.
+ */
+void set_free_data_batch_function(SinglyLinkedList *singly_linked_list, FreeDataBatchFunction free_data_batch_function);
+
+/**
+ * \brief Sets how many nodes ahead of the current one the traversals of the singly linked list prefetch.
+ *
+ * The linear scans of `find_node_by_data`, `delete_node_by_data`, `print_singly_linked_list` and
+ * `free_singly_linked_list` prefetch the node `prefetch_distance` positions ahead and its data while they
+ * visit the current node. Larger distances hide more latency on lists scattered in memory, as long as the
+ * prefetched lines are not evicted before they are reached. Lists start with
+ * `SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose prefetch distance will be set.
+ * \param prefetch_distance The number of nodes to prefetch ahead, or 0 to disable prefetching.
+ */
+void set_prefetch_distance(SinglyLinkedList *singly_linked_list, size_t prefetch_distance);
+
+/**
+ * \brief Detaches and frees the hash index of the singly linked list, if it has one.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose index will be removed.
+ */
+void detach_hash_index(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Attaches a skip list index to the sorted singly linked list.
+ *
+ * This function checks that the list is sorted by its `order_data_function` and builds express lanes over its
+ * `next_node` chain in a single pass. From then on, `insert_node_into_sorted_list`, `find_node_in_sorted_list` and
+ * `delete_node_from_sorted_list` run in expected O(log n) time, and `delete_node_by_data` keeps the index in sync.
+ * The nodes are not moved or relinked, so the list can still be traversed and printed as before. Inserting at the
+ * head or tail, bulk inserting, reversing, radix sorting and changing the order function can break the order of the
+ * list, so they detach the index. Any index previously attached to the list is replaced.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ *
+ * \return true if the index was attached, false if an error occurred.
+ */
+bool attach_skip_list_index(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Attaches a skip list index to the sorted singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `attach_skip_list_index`. On failure any previously attached index is kept.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, `SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT` if the list has no order function,
+ * `SINGLY_LINKED_LIST_ERROR_NOT_SORTED` if the list is not sorted by it, or the reason the index could not be attached.
+ */
+SinglyLinkedListStatus try_attach_skip_list_index(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Detaches and frees the skip list index of the singly linked list, if it has one.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose index will be removed.
+ */
+void detach_skip_list_index(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Inserts a new node into the sorted singly linked list, keeping it sorted.
+ *
+ * This function links the new node after every node whose data goes before or is equivalent to `node_data`
+ * according to the `order_data_function` of the list, so insertions are stable. With a skip list index attached,
+ * the position is found in expected O(log n) time and the node is added to the index; otherwise the list is
+ * scanned from its head. If the index cannot be updated, it is detached and an error is reported, but the node
+ * stays in the list.
+ *
+ * \param singly_linked_list A pointer to the sorted `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_into_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Inserts a new node into the sorted singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_into_sorted_list`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the sorted `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_into_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Searches the sorted singly linked list for the first node whose data is equivalent to the provided data.
+ *
+ * Nodes are matched with the `order_data_function` of the list rather than its compare function. With a skip
+ * list index attached, the search takes expected O(log n) time; otherwise the list is scanned from its head
+ * and the scan stops at the first node that goes after `node_data`.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ *
+ * \return A pointer to the first node containing equivalent data, or `NULL` if no node is found.
+ */
+Node *find_node_in_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Searches the sorted singly linked list for the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `find_node_in_sorted_list`. Not finding a matching node is not an error: the function
+ * succeeds and stores `NULL` in `found_node`.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ * \param found_node Where the matching node, or `NULL` if there is none, is stored.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_find_node_in_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data, Node **found_node);
+
+/**
+ * \brief Deletes every node of the sorted singly linked list whose data is equivalent to the provided data.
+ *
+ * The matching nodes are found like in `find_node_in_sorted_list` and, being adjacent, are unlinked in a single
+ * splice. Their data is freed, they are returned to the node pool of the list, and they are removed from the
+ * attached indexes.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list.
+ *
+ * \return The number of nodes that were deleted from the list, saturated to `INT_MAX`.
+ */
+int delete_node_from_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data);
+
+/**
+ * \brief Deletes the nodes of the sorted singly linked list equivalent to the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_node_from_sorted_list`, but stores the exact number of deleted nodes.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_delete_node_from_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data, size_t *deleted_nodes_count);
+
 #endif
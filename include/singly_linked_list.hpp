@@ -0,0 +1,588 @@
+#ifndef SINGLY_LINKED_LIST_HPP
+#define SINGLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/**
+ * \namespace sll
+ * \brief Header-only C++ counterpart of `singly_linked_list.h`.
+ *
+ * The types in this namespace keep the node layout of the C library, the data followed by a pointer to
+ * the next node, but store the value inline instead of behind a `NodeData` pointer, and replace the
+ * print, free and compare function pointers with compile-time functors.
+ */
+namespace sll
+{
+  /**
+   * \struct no_free
+   * \brief The default free functor, which leaves the value to its destructor.
+   */
+  struct no_free
+  {
+    template <typename T>
+    void operator()(T &) const noexcept
+    {
+    }
+  };
+
+  /**
+   * \struct node
+   * \brief A structure representing a node of a `sll::list`.
+   *
+   * This structure mirrors `Node` from `singly_linked_list.h`, with the value stored inline.
+   */
+  template <typename T>
+  struct node
+  {
+    T node_data;     /**< The value stored in the node. */
+    node *next_node; /**< Pointer to the next node in the list. */
+
+    template <typename... Args>
+    explicit node(Args &&...args) : node_data(std::forward<Args>(args)...), next_node(nullptr)
+    {
+    }
+  };
+
+  /**
+   * \class list
+   * \brief A singly linked list storing values of type `T` inline.
+   *
+   * Nodes are allocated through `Alloc`, rebound to `node<T>`. `Compare` is the equality functor used by
+   * `find` and `remove`, and `Free` is called on every value right before its node is destroyed, so that
+   * lists of owning handles can release them the same way `free_data_function` does in the C library.
+   *
+   * \tparam T The type of the values stored in the list. Move-only types are supported.
+   * \tparam Alloc The allocator used for the nodes.
+   * \tparam Compare The equality functor used to compare values.
+   * \tparam Free The functor called on every value before it is destroyed.
+   */
+  template <typename T, typename Alloc = std::allocator<T>, typename Compare = std::equal_to<T>, typename Free = no_free>
+  class list
+  {
+  public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using node_type = node<T>;
+
+    /**
+     * \class basic_iterator
+     * \brief A forward iterator over the values of a `sll::list`.
+     */
+    template <bool IsConst>
+    class basic_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<IsConst, const T *, T *>;
+      using reference = std::conditional_t<IsConst, const T &, T &>;
+
+      basic_iterator() noexcept = default;
+
+      explicit basic_iterator(node_type *current_node) noexcept : current_node_(current_node)
+      {
+      }
+
+      operator basic_iterator<true>() const noexcept
+      {
+        return basic_iterator<true>(current_node_);
+      }
+
+      reference operator*() const noexcept
+      {
+        return current_node_->node_data;
+      }
+
+      pointer operator->() const noexcept
+      {
+        return &current_node_->node_data;
+      }
+
+      basic_iterator &operator++() noexcept
+      {
+        current_node_ = current_node_->next_node;
+
+        return *this;
+      }
+
+      basic_iterator operator++(int) noexcept
+      {
+        basic_iterator previous_iterator = *this;
+
+        current_node_ = current_node_->next_node;
+
+        return previous_iterator;
+      }
+
+      friend bool operator==(const basic_iterator &first_iterator, const basic_iterator &second_iterator) noexcept
+      {
+        return first_iterator.current_node_ == second_iterator.current_node_;
+      }
+
+      friend bool operator!=(const basic_iterator &first_iterator, const basic_iterator &second_iterator) noexcept
+      {
+        return first_iterator.current_node_ != second_iterator.current_node_;
+      }
+
+      node_type *get_node() const noexcept
+      {
+        return current_node_;
+      }
+
+    private:
+      node_type *current_node_ = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    list() noexcept(noexcept(Alloc())) = default;
+
+    explicit list(const Alloc &allocator) noexcept : node_allocator_(allocator)
+    {
+    }
+
+    list(const list &other) : node_allocator_(std::allocator_traits<node_allocator_type>::select_on_container_copy_construction(other.node_allocator_))
+    {
+      for (const T &value : other)
+      {
+        emplace_back(value);
+      }
+    }
+
+    list(list &&other) noexcept
+        : head_node_(std::exchange(other.head_node_, nullptr)),
+          tail_node_(std::exchange(other.tail_node_, nullptr)),
+          length_(std::exchange(other.length_, 0)),
+          node_allocator_(std::move(other.node_allocator_))
+    {
+    }
+
+    /**
+     * \brief Replaces the values of the list with copies of the values of `other`.
+     *
+     * The copies are allocated with the allocator of `other` if it propagates on copy assignment, and with the
+     * allocator of the list otherwise. If a copy throws, the list is left unchanged.
+     */
+    list &operator=(const list &other)
+    {
+      if (this != &other)
+      {
+        list copy(node_allocator_traits::propagate_on_container_copy_assignment::value ? other.get_allocator() : get_allocator());
+
+        for (const T &value : other)
+        {
+          copy.emplace_back(value);
+        }
+
+        std::swap(head_node_, copy.head_node_);
+        std::swap(tail_node_, copy.tail_node_);
+        std::swap(length_, copy.length_);
+
+        /* The old nodes leave with the copy, so they must be released by the allocator that created them. */
+        if constexpr (node_allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+          std::swap(node_allocator_, copy.node_allocator_);
+        }
+      }
+
+      return *this;
+    }
+
+    /**
+     * \brief Replaces the values of the list with the values of `other`.
+     *
+     * The nodes of `other` are taken over when its allocator propagates on move assignment or is equal to the
+     * allocator of the list. Otherwise they could not be released by the allocator of the list, so every value is
+     * moved into a new node instead, and `other` is emptied without calling `Free` on the moved-from values.
+     */
+    list &operator=(list &&other) noexcept(node_allocator_traits::propagate_on_container_move_assignment::value || node_allocator_traits::is_always_equal::value)
+    {
+      if (this != &other)
+      {
+        clear();
+
+        if constexpr (node_allocator_traits::propagate_on_container_move_assignment::value)
+        {
+          node_allocator_ = std::move(other.node_allocator_);
+
+          take_nodes(other);
+        }
+        else if (node_allocator_ == other.node_allocator_)
+        {
+          take_nodes(other);
+        }
+        else
+        {
+          for (T &value : other)
+          {
+            emplace_back(std::move(value));
+          }
+
+          other.destroy_moved_from_nodes();
+        }
+      }
+
+      return *this;
+    }
+
+    ~list()
+    {
+      clear();
+    }
+
+    /**
+     * \brief Constructs a value in place at the head of the list.
+     *
+     * \return A reference to the inserted value.
+     */
+    template <typename... Args>
+    reference emplace_front(Args &&...args)
+    {
+      node_type *new_node = create_node(std::forward<Args>(args)...);
+
+      new_node->next_node = head_node_;
+      head_node_ = new_node;
+
+      if (tail_node_ == nullptr)
+      {
+        tail_node_ = new_node;
+      }
+
+      length_++;
+
+      return new_node->node_data;
+    }
+
+    /**
+     * \brief Constructs a value in place at the tail of the list.
+     *
+     * \return A reference to the inserted value.
+     */
+    template <typename... Args>
+    reference emplace_back(Args &&...args)
+    {
+      node_type *new_node = create_node(std::forward<Args>(args)...);
+
+      if (tail_node_ == nullptr)
+      {
+        head_node_ = new_node;
+      }
+      else
+      {
+        tail_node_->next_node = new_node;
+      }
+
+      tail_node_ = new_node;
+      length_++;
+
+      return new_node->node_data;
+    }
+
+    void push_front(const T &value)
+    {
+      emplace_front(value);
+    }
+
+    void push_front(T &&value)
+    {
+      emplace_front(std::move(value));
+    }
+
+    void push_back(const T &value)
+    {
+      emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+      emplace_back(std::move(value));
+    }
+
+    /**
+     * \brief Removes the value at the head of the list. The list must not be empty.
+     */
+    void pop_front()
+    {
+      node_type *node_to_delete = head_node_;
+
+      head_node_ = node_to_delete->next_node;
+
+      if (head_node_ == nullptr)
+      {
+        tail_node_ = nullptr;
+      }
+
+      destroy_node(node_to_delete);
+
+      length_--;
+    }
+
+    /**
+     * \brief Returns an iterator to the first value equal to `value`, or `end()` if there is none.
+     */
+    template <typename Key>
+    iterator find(const Key &value)
+    {
+      for (node_type *current_node = head_node_; current_node != nullptr; current_node = current_node->next_node)
+      {
+        if (compare_(current_node->node_data, value))
+        {
+          return iterator(current_node);
+        }
+      }
+
+      return end();
+    }
+
+    template <typename Key>
+    const_iterator find(const Key &value) const
+    {
+      return const_cast<list *>(this)->find(value);
+    }
+
+    /**
+     * \brief Removes every value equal to `value`.
+     *
+     * \return The number of values that were removed.
+     */
+    template <typename Key>
+    size_type remove(const Key &value)
+    {
+      size_type deleted_nodes_count = 0;
+      node_type **link = &head_node_;
+      node_type *previous_node = nullptr;
+
+      while (*link != nullptr)
+      {
+        node_type *current_node = *link;
+
+        if (compare_(current_node->node_data, value))
+        {
+          *link = current_node->next_node;
+
+          destroy_node(current_node);
+
+          deleted_nodes_count++;
+        }
+        else
+        {
+          previous_node = current_node;
+          link = &current_node->next_node;
+        }
+      }
+
+      tail_node_ = previous_node;
+      length_ -= deleted_nodes_count;
+
+      return deleted_nodes_count;
+    }
+
+    /**
+     * \brief Reverses the order of the values in the list.
+     */
+    void reverse() noexcept
+    {
+      node_type *previous_node = nullptr;
+      node_type *current_node = head_node_;
+
+      while (current_node != nullptr)
+      {
+        node_type *next_node = current_node->next_node;
+
+        current_node->next_node = previous_node;
+        previous_node = current_node;
+        current_node = next_node;
+      }
+
+      tail_node_ = head_node_;
+      head_node_ = previous_node;
+    }
+
+    /**
+     * \brief Removes every value from the list.
+     */
+    void clear() noexcept
+    {
+      node_type *current_node = head_node_;
+
+      while (current_node != nullptr)
+      {
+        node_type *next_node = current_node->next_node;
+
+        destroy_node(current_node);
+
+        current_node = next_node;
+      }
+
+      head_node_ = nullptr;
+      tail_node_ = nullptr;
+      length_ = 0;
+    }
+
+    /**
+     * \brief Calls `print_data_function` on every value of the list, in order.
+     */
+    template <typename Print>
+    void print(Print &&print_data_function) const
+    {
+      for (const T &value : *this)
+      {
+        print_data_function(value);
+      }
+    }
+
+    void swap(list &other) noexcept
+    {
+      std::swap(head_node_, other.head_node_);
+      std::swap(tail_node_, other.tail_node_);
+      std::swap(length_, other.length_);
+
+      if constexpr (std::allocator_traits<node_allocator_type>::propagate_on_container_swap::value)
+      {
+        std::swap(node_allocator_, other.node_allocator_);
+      }
+    }
+
+    size_type size() const noexcept
+    {
+      return length_;
+    }
+
+    bool empty() const noexcept
+    {
+      return length_ == 0;
+    }
+
+    reference front() noexcept
+    {
+      return head_node_->node_data;
+    }
+
+    const_reference front() const noexcept
+    {
+      return head_node_->node_data;
+    }
+
+    reference back() noexcept
+    {
+      return tail_node_->node_data;
+    }
+
+    const_reference back() const noexcept
+    {
+      return tail_node_->node_data;
+    }
+
+    iterator begin() noexcept
+    {
+      return iterator(head_node_);
+    }
+
+    iterator end() noexcept
+    {
+      return iterator();
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(head_node_);
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator();
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(node_allocator_);
+    }
+
+  private:
+    using node_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_allocator_traits = std::allocator_traits<node_allocator_type>;
+
+    template <typename... Args>
+    node_type *create_node(Args &&...args)
+    {
+      node_type *new_node = node_allocator_traits::allocate(node_allocator_, 1);
+
+      try
+      {
+        node_allocator_traits::construct(node_allocator_, new_node, std::forward<Args>(args)...);
+      }
+      catch (...)
+      {
+        node_allocator_traits::deallocate(node_allocator_, new_node, 1);
+
+        throw;
+      }
+
+      return new_node;
+    }
+
+    void destroy_node(node_type *node_to_delete) noexcept
+    {
+      free_(node_to_delete->node_data);
+
+      node_allocator_traits::destroy(node_allocator_, node_to_delete);
+      node_allocator_traits::deallocate(node_allocator_, node_to_delete, 1);
+    }
+
+    /**
+     * \brief Destroys every node without calling `Free`, once the values have been moved into another list.
+     */
+    void destroy_moved_from_nodes() noexcept
+    {
+      node_type *current_node = head_node_;
+
+      while (current_node != nullptr)
+      {
+        node_type *next_node = current_node->next_node;
+
+        node_allocator_traits::destroy(node_allocator_, current_node);
+        node_allocator_traits::deallocate(node_allocator_, current_node, 1);
+
+        current_node = next_node;
+      }
+
+      head_node_ = nullptr;
+      tail_node_ = nullptr;
+      length_ = 0;
+    }
+
+    /**
+     * \brief Takes over the nodes of `other`, whose allocator must be able to release them. The list must be empty.
+     */
+    void take_nodes(list &other) noexcept
+    {
+      head_node_ = std::exchange(other.head_node_, nullptr);
+      tail_node_ = std::exchange(other.tail_node_, nullptr);
+      length_ = std::exchange(other.length_, 0);
+    }
+
+    node_type *head_node_ = nullptr; /**< Pointer to the first node in the list. */
+    node_type *tail_node_ = nullptr; /**< Pointer to the last node in the list. */
+    size_type length_ = 0;           /**< Number of nodes currently in the list. */
+    node_allocator_type node_allocator_;
+    Compare compare_;
+    Free free_;
+  };
+
+  template <typename T, typename Alloc, typename Compare, typename Free>
+  void swap(list<T, Alloc, Compare, Free> &first_list, list<T, Alloc, Compare, Free> &second_list) noexcept
+  {
+    first_list.swap(second_list);
+  }
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef SINGLY_LINKED_LIST_COMPACTION_H
+#define SINGLY_LINKED_LIST_COMPACTION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \typedef NodeData (*RelocateDataFunction)(NodeData)
+ * \brief A function pointer type for a function that moves the data of a node to a new address.
+ *
+ * A compaction calls it on the data of every node it moves, in list order, and stores the returned pointer in the
+ * moved node. Handing out consecutive addresses from an arena colocates the data in list order next to the nodes.
+ * The function owns the old data and must release it if it returns another address, and the new data must
+ * still be freed by the `free_data_function` of the list. It may return its argument to leave the data in place.
+ */
+typedef NodeData (*RelocateDataFunction)(NodeData);
+
+/**
+ * \brief Moves all the nodes of the singly linked list into a single contiguous block, in list order.
+ *
+ * After long sequences of insertions and deletions, the nodes of a list are scattered over its pool and consecutive
+ * nodes rarely share a cache line or a page. This function allocates one block of `length` nodes, copies every node
+ * into it in list order, rewrites `head_node` and `tail_node`, and returns all the previous slabs of the pool to the
+ * system. The data of every node is passed to `relocate_data_function` if one is provided.
+ *
+ * Every `Node` pointer obtained from the list before the call is invalidated. An attached hash index and an
+ * attached skip list index are updated to the moved nodes. An incremental compaction in progress is canceled first.
+ * If the block cannot be allocated, an error is reported and the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param relocate_data_function A function pointer used to move the data of every node, or `NULL` to leave it in place.
+ *
+ * \return true if the list was compacted, false if an error occurred and the list was left untouched.
+ */
+bool compact_singly_linked_list(SinglyLinkedList *singly_linked_list, RelocateDataFunction relocate_data_function);
+
+/**
+ * \brief Moves all the nodes of the singly linked list into a single contiguous block and reports the outcome as a status code.
+ *
+ * This function behaves like `compact_singly_linked_list`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param relocate_data_function A function pointer used to move the data of every node, or `NULL` to leave it in place.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be compacted.
+ */
+SinglyLinkedListStatus try_compact_singly_linked_list(SinglyLinkedList *singly_linked_list, RelocateDataFunction relocate_data_function);
+
+/**
+ * \brief Moves at most the provided number of nodes of the singly linked list into a fresh pool, in list order.
+ *
+ * The first call starts an incremental compaction: the current pool of the list is set aside and new nodes,
+ * including the ones inserted until the compaction ends, are allocated from a fresh pool. Every call then moves
+ * the next `max_node_count` nodes after the last moved one, so the work done per call is bounded and the calls can
+ * be spread between other operations. Once the node that was the tail when the compaction started has been moved,
+ * the set aside pool is returned to the system and the compaction ends. The nodes inserted after it are already in
+ * the fresh pool, so they are not moved again.
+ *
+ * Insertions and deletions may happen between calls. Operations that relink the existing nodes, such as reversing
+ * or sorting the list, cancel the compaction, keeping the nodes moved so far. Every `Node` pointer to a moved node is
+ * invalidated. An attached hash index is updated to the moved nodes, and an attached skip list index is detached
+ * when the compaction starts.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param max_node_count The maximum number of nodes to move in this call. This must be greater than 0.
+ * \param relocate_data_function A function pointer used to move the data of every moved node, or `NULL` to leave it in place.
+ *
+ * \return true if the compaction is complete, false if nodes remain to be moved or an error occurred.
+ */
+bool compact_singly_linked_list_incrementally(SinglyLinkedList *singly_linked_list, size_t max_node_count, RelocateDataFunction relocate_data_function);
+
+/**
+ * \brief Moves at most the provided number of nodes of the singly linked list into a fresh pool and reports the outcome as a status code.
+ *
+ * This function behaves like `compact_singly_linked_list_incrementally`. If a node cannot be allocated, the
+ * nodes moved so far stay moved and the compaction remains in progress.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param max_node_count The maximum number of nodes to move in this call. This must be greater than 0.
+ * \param relocate_data_function A function pointer used to move the data of every moved node, or `NULL` to leave it in place.
+ * \param is_compaction_complete Where whether the compaction is complete is stored on success. This can be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_compact_singly_linked_list_incrementally(SinglyLinkedList *singly_linked_list, size_t max_node_count, RelocateDataFunction relocate_data_function, bool *is_compaction_complete);
+
+/**
+ * \brief Cancels the incremental compaction of the singly linked list in progress, if there is one.
+ *
+ * The nodes moved so far stay where they are, and the set aside pool is merged back into the pool of the list,
+ * so no node is invalidated. Operations that relink the existing nodes of a list call this function themselves.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose compaction is canceled.
+ */
+void cancel_singly_linked_list_compaction(SinglyLinkedList *singly_linked_list);
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef SINGLY_LINKED_LIST_SORT_H
+#define SINGLY_LINKED_LIST_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def PARALLEL_SORT_MINIMUM_NODES_PER_THREAD
+ * \brief The minimum number of nodes each thread of a parallel sort is given.
+ *
+ * Lists too short to give every requested thread this many nodes are sorted with fewer threads, since starting
+ * a thread costs more than sorting a short run. It can be overridden at compile time.
+ */
+#ifndef PARALLEL_SORT_MINIMUM_NODES_PER_THREAD
+#define PARALLEL_SORT_MINIMUM_NODES_PER_THREAD 65536
+#endif
+
+/**
+ * \typedef uint64_t (*IntegerKeyFunction)(NodeData)
+ * \brief A function pointer type for a function that extracts an unsigned integer sort key from the data of a node.
+ *
+ * Nodes are sorted by ascending key. Signed keys can be mapped to this order by flipping their sign bit, for
+ * example with `(uint64_t)value ^ (UINT64_C(1) << 63)` for an `int64_t`.
+ */
+typedef uint64_t (*IntegerKeyFunction)(NodeData);
+
+/**
+ * \typedef const unsigned char *(*ByteStringKeyFunction)(NodeData, size_t *)
+ * \brief A function pointer type for a function that extracts a byte string sort key from the data of a node.
+ *
+ * The function returns a pointer to the bytes of the key and stores their number in its second argument.
+ * Nodes are sorted by the lexicographic order of their keys, with keys shorter than the longest one compared
+ * as if they were padded with zero bytes. The bytes must stay unchanged while the list is being sorted.
+ */
+typedef const unsigned char *(*ByteStringKeyFunction)(NodeData, size_t *);
+
+/**
+ * \brief Sorts the singly linked list in place with a bottom-up merge sort.
+ *
+ * This function orders the nodes of the list with the `order_data_function` of the list by relinking their
+ * `next_node` pointers, so no node is allocated, copied or moved, and updates `head_node` and `tail_node`.
+ * The sort is stable and runs in O(n log n) time. Instead of recursing, it keeps one pending sorted run per
+ * power of two, like the digits of a binary counter, so the only extra space is a fixed array of pending runs.
+ * An attached hash index stays valid, since the nodes keep their addresses, and so does an attached skip list
+ * index, since a stable sort leaves a list already sorted by the same function unchanged.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool sort_singly_linked_list(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Sorts the singly linked list in place and reports the outcome as a status code.
+ *
+ * This function behaves like `sort_singly_linked_list`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_sort_singly_linked_list(SinglyLinkedList *singly_linked_list);
+
+/**
+ * \brief Sorts the singly linked list in place using several threads.
+ *
+ * This function splits the chain of nodes into one run of consecutive nodes per thread, sorts the runs
+ * concurrently with the same merge sort as `sort_singly_linked_list`, and then merges them pairwise, one
+ * round of concurrent merges at a time, until a single run is left. The result is stable and identical to the
+ * one of `sort_singly_linked_list`. The threads are started for each call and joined before it returns. If a
+ * thread cannot be started, its share of the work is done by the calling thread instead.
+ *
+ * Splitting the chain and the last merge visit every node on a single thread, so the speedup is bounded by
+ * the memory bandwidth available to one core for those two passes.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param thread_count The maximum number of threads to use, including the calling thread. 0 is treated as 1.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool sort_singly_linked_list_in_parallel(SinglyLinkedList *singly_linked_list, size_t thread_count);
+
+/**
+ * \brief Sorts the singly linked list in place using several threads and reports the outcome as a status code.
+ *
+ * This function behaves like `sort_singly_linked_list_in_parallel`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param thread_count The maximum number of threads to use, including the calling thread. 0 is treated as 1.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_sort_singly_linked_list_in_parallel(SinglyLinkedList *singly_linked_list, size_t thread_count);
+
+/**
+ * \brief Sorts the singly linked list in place with an LSD radix sort on an integer key.
+ *
+ * This function distributes the nodes into 256 bucket chains by one byte of their key at a time, starting from
+ * the least significant one, and concatenates the chains through their `next_node` pointers after every pass,
+ * so no memory is allocated. Bytes that are equal in every key are skipped, so small keys take fewer than the
+ * eight passes of a full 64-bit key. The sort is stable and runs in linear time. The key function is called
+ * once per node and pass, and `head_node` and `tail_node` are updated. Since the key order may differ from the
+ * `order_data_function` of the list, any attached skip list index is detached.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param integer_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool radix_sort_singly_linked_list_by_integer_key(SinglyLinkedList *singly_linked_list, IntegerKeyFunction integer_key_function);
+
+/**
+ * \brief Sorts the singly linked list with an LSD radix sort on an integer key and reports the outcome as a status code.
+ *
+ * This function behaves like `radix_sort_singly_linked_list_by_integer_key`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param integer_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_radix_sort_singly_linked_list_by_integer_key(SinglyLinkedList *singly_linked_list, IntegerKeyFunction integer_key_function);
+
+/**
+ * \brief Sorts the singly linked list in place with an LSD radix sort on a byte string key.
+ *
+ * This function works like `radix_sort_singly_linked_list_by_integer_key`, with one pass per byte of the longest
+ * key, starting from the last one. It runs in time proportional to the number of nodes times the length of the
+ * longest key, so it suits fixed-width keys best.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param byte_string_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool radix_sort_singly_linked_list_by_byte_string_key(SinglyLinkedList *singly_linked_list, ByteStringKeyFunction byte_string_key_function);
+
+/**
+ * \brief Sorts the singly linked list with an LSD radix sort on a byte string key and reports the outcome as a status code.
+ *
+ * This function behaves like `radix_sort_singly_linked_list_by_byte_string_key`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param byte_string_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_radix_sort_singly_linked_list_by_byte_string_key(SinglyLinkedList *singly_linked_list, ByteStringKeyFunction byte_string_key_function);
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SINGLY_LINKED_LIST_STATUS_H
+#define SINGLY_LINKED_LIST_STATUS_H
+
+#ifndef NDEBUG
+#include <stdio.h>
+#endif
+
+/**
+ * \enum SinglyLinkedListStatus
+ * \brief The outcome of an operation on a singly linked list.
+ */
+typedef enum SinglyLinkedListStatus
+{
+  SINGLY_LINKED_LIST_SUCCESS = 0,             /**< The operation succeeded. */
+  SINGLY_LINKED_LIST_ERROR_NULL_LIST,         /**< The list passed to the operation was `NULL`. */
+  SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT,     /**< A required function pointer or array argument was `NULL`. */
+  SINGLY_LINKED_LIST_ERROR_NULL_DATA,         /**< The data to be stored in a node was `NULL`. */
+  SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, /**< A memory allocation failed. */
+  SINGLY_LINKED_LIST_ERROR_EMPTY_LIST,        /**< The operation requires a non-empty list. */
+  SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED, /**< A fixed-size resource, such as the hazard pointer records, is exhausted. */
+  SINGLY_LINKED_LIST_ERROR_NOT_SORTED,        /**< The operation requires a list sorted by its order function. */
+  SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT   /**< A size or count argument is out of range. */
+} SinglyLinkedListStatus;
+
+/**
+ * \typedef void (*ErrorHandlerFunction)(SinglyLinkedListStatus, const char *)
+ * \brief A function pointer type for a function that is notified of every error reported by the library.
+ *
+ * The handler receives the status of the failed operation and a static, human-readable description of the error.
+ */
+typedef void (*ErrorHandlerFunction)(SinglyLinkedListStatus, const char *);
+
+/**
+ * \brief Sets the function notified of every error reported by the library.
+ *
+ * The handler is global and is not synchronized, so it should be set before the library is used by
+ * several threads. Passing `NULL` removes the current handler.
+ *
+ * \param error_handler_function A function pointer called on every error, or `NULL`.
+ */
+void set_singly_linked_list_error_handler(ErrorHandlerFunction error_handler_function);
+
+/**
+ * \brief Returns a static, human-readable description of a status.
+ *
+ * \param status The status to be described.
+ *
+ * \return The description of the status.
+ */
+const char *get_singly_linked_list_status_message(SinglyLinkedListStatus status);
+
+/**
+ * \brief Notifies the error handler, if one is set, of an error.
+ *
+ * This function is called by `REPORT_SINGLY_LINKED_LIST_ERROR` and does not print anything.
+ *
+ * \param status The status of the failed operation.
+ * \param message A static description of the error.
+ */
+void report_singly_linked_list_error(SinglyLinkedListStatus status, const char *message);
+
+/**
+ * \def REPORT_SINGLY_LINKED_LIST_ERROR(status, message)
+ * \brief Reports an error to the error handler and, in debug builds, prints it.
+ *
+ * When `NDEBUG` is defined, the diagnostic `printf` is compiled out entirely, so an error path only costs
+ * the check for an error handler.
+ */
+#ifdef NDEBUG
+#define REPORT_SINGLY_LINKED_LIST_ERROR(status, message) report_singly_linked_list_error((status), (message))
+#else
+#define REPORT_SINGLY_LINKED_LIST_ERROR(status, message) \
+  (printf("[ERROR] %s\n", (message)), report_singly_linked_list_error((status), (message)))
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef SKIP_LIST_INDEX_H
+#define SKIP_LIST_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def SKIP_LIST_INDEX_MAX_LANES
+ * \brief The maximum number of express lanes of a skip list index.
+ *
+ * Every lane skips over about four times as many nodes as the one below it, so 32 lanes are enough for any list.
+ */
+#ifndef SKIP_LIST_INDEX_MAX_LANES
+#define SKIP_LIST_INDEX_MAX_LANES 32
+#endif
+
+/**
+ * \struct SkipListTower
+ * \brief A structure representing the express lanes of a single node of a skip list index.
+ *
+ * Only about a quarter of the nodes get a tower. The base lane of the skip list is the `next_node` chain of the
+ * list itself, so nodes without a tower cost nothing.
+ */
+typedef struct SkipListTower
+{
+  Node *node;                          /**< Pointer to the node this tower belongs to. */
+  size_t height;                       /**< Number of express lanes the tower is linked into. */
+  struct SkipListTower *next_towers[]; /**< The next tower in every lane, from the lowest express lane up, or `NULL` at the end of a lane. */
+} SkipListTower;
+
+/**
+ * \struct SkipListIndex
+ * \brief A structure representing a probabilistic skip list layered over a sorted chain of nodes.
+ *
+ * The express lanes let a search skip most of the chain, so finding the position of some data takes
+ * expected O(log n) steps. Towers are given a random height with a private generator, so the index does not
+ * touch the state of `rand`.
+ */
+typedef struct SkipListIndex
+{
+  SkipListTower *first_towers[SKIP_LIST_INDEX_MAX_LANES]; /**< The first tower of every lane, or `NULL` for the empty ones. */
+  size_t lane_count;                                      /**< Number of lanes holding at least one tower. */
+  uint64_t random_state;                                  /**< State of the generator of tower heights. */
+  OrderDataFunction order_data_function;                  /**< Function pointer for ordering node data. */
+} SkipListIndex;
+
+/**
+ * \brief Creates a new empty skip list index.
+ *
+ * \param order_data_function A function pointer used to order node data. This cannot be `NULL`.
+ *
+ * \return A pointer to the newly created `SkipListIndex` if successful, or `NULL` if an error occurs.
+ */
+SkipListIndex *create_skip_list_index(OrderDataFunction order_data_function);
+
+/**
+ * \brief Builds the towers of the skip list index over a sorted chain of nodes.
+ *
+ * The index must be empty. The towers are appended to the lanes in a single pass over the chain.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be built.
+ * \param head_node The first node of the chain, which must be sorted by the order function of the index.
+ *
+ * \return true if the index was built, false if a tower could not be allocated.
+ */
+bool build_skip_list_index(SkipListIndex *skip_list_index, Node *head_node);
+
+/**
+ * \brief Finds the last node reachable through the express lanes that goes before the provided data.
+ *
+ * The search can be continued along the `next_node` chain from the returned node, which is expected to be only
+ * a few nodes away from the position of the data.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to search in.
+ * \param node_data The data to search for.
+ * \param include_equivalent Whether nodes whose data is equivalent to `node_data` also count as going before it.
+ *
+ * \return A pointer to the node, or `NULL` if the search has to start from the head of the chain.
+ */
+Node *find_predecessor_in_skip_list_index(SkipListIndex *skip_list_index, NodeData node_data, bool include_equivalent);
+
+/**
+ * \brief Gives a node that was just linked into the chain a tower of random height, if it draws one.
+ *
+ * The node must have been linked after every node whose data is equivalent to its own.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` where the node will be added.
+ * \param node A pointer to the node to be indexed.
+ *
+ * \return true if the node was added, false if its tower could not be allocated.
+ */
+bool insert_node_into_skip_list_index(SkipListIndex *skip_list_index, Node *node);
+
+/**
+ * \brief Removes the tower of a node from the skip list index, if it has one.
+ *
+ * The data of the node must still be valid, since it is ordered to locate the tower.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` from which the node will be removed.
+ * \param node A pointer to the node to be removed.
+ */
+void remove_node_from_skip_list_index(SkipListIndex *skip_list_index, Node *node);
+
+/**
+ * \brief Removes every tower from the skip list index.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be cleared.
+ */
+void clear_skip_list_index(SkipListIndex *skip_list_index);
+
+/**
+ * \brief Frees the skip list index and its towers. The indexed nodes are not touched.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be freed.
+ */
+void free_skip_list_index(SkipListIndex *skip_list_index);
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef TYPED_SINGLY_LINKED_LIST_H
+#define TYPED_SINGLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "singly_linked_list_status.h"
+
+/**
+ * \def DEFINE_SINGLY_LINKED_LIST(name, T, cmp)
+ * \brief Generates a singly linked list specialized for values of type `T`.
+ *
+ * The generated list stores every value inline in its node instead of boxing it behind a `NodeData`
+ * pointer, and compares values with `cmp`, which is expanded directly into the search loops so that the
+ * compiler can inline it. `cmp` can be a function or a function-like macro taking two `T` values and
+ * returning `true` when they are equal.
+ *
+ * For a given `name`, the macro defines the types `name` and `name##_node` and the following functions,
+ * which mirror the operations declared in `singly_linked_list.h`:
+ *
+ * - `name *name##_create(void (*print_data_function)(T), void (*free_data_function)(T))`
+ * - `name##_node *name##_create_node(T node_data)`
+ * - `void name##_insert_node_at_head(name *list, T node_data)`
+ * - `void name##_insert_node_at_tail(name *list, T node_data)`
+ * - `void name##_print(name *list)`
+ * - `void name##_free(name *list)`
+ * - `size_t name##_get_length(name *list)`
+ * - `void name##_reverse(name *list)`
+ * - `name##_node *name##_find_node_by_data(name *list, T node_data)`
+ * - `bool name##_is_valid(name *list)`
+ * - `size_t name##_delete_node_by_data(name *list, T node_data)`
+ *
+ * `free_data_function` may be `NULL` for values that do not own any resources, in which case freeing
+ * or deleting nodes does not make any indirect call. Errors are reported with `REPORT_SINGLY_LINKED_LIST_ERROR`,
+ * so a program that uses the generated list must also be linked with `singly_linked_list_status.c`.
+ *
+ * \param name The name of the generated list type, also used as the prefix of its functions.
+ * \param T The type of the values stored in the list.
+ * \param cmp The equality comparison used by the find and delete operations.
+ */
+#define DEFINE_SINGLY_LINKED_LIST(name, T, cmp)                                                                                      \
+  typedef struct name##_node                                                                                                         \
+  {                                                                                                                                  \
+    T node_data;                   /**< The value stored in the node. */                                                             \
+    struct name##_node *next_node; /**< Pointer to the next node in the list. */                                                     \
+  } name##_node;                                                                                                                     \
+                                                                                                                                     \
+  typedef struct name                                                                                                                \
+  {                                                                                                                                  \
+    name##_node *head_node;                 /**< Pointer to the first node in the list. */                                           \
+    name##_node *tail_node;                 /**< Pointer to the last node in the list. */                                            \
+    size_t length;                          /**< Number of nodes currently in the list. */                                           \
+    void (*print_data_function)(T);         /**< Function pointer for printing node data. */                                         \
+    void (*free_data_function)(T);          /**< Function pointer for freeing node data, or `NULL`. */                               \
+  } name;                                                                                                                            \
+                                                                                                                                     \
+  static inline bool name##_is_valid(name *list)                                                                                     \
+  {                                                                                                                                  \
+    return list != NULL;                                                                                                             \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline name *name##_create(void (*print_data_function)(T), void (*free_data_function)(T))                                   \
+  {                                                                                                                                  \
+    if (print_data_function == NULL)                                                                                                 \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");              \
+                                                                                                                                     \
+      return NULL;                                                                                                                   \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name *list = (name *)malloc(sizeof(name));                                                                                       \
+                                                                                                                                     \
+    if (list == NULL)                                                                                                                \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for '" #name "'.");      \
+                                                                                                                                     \
+      return NULL;                                                                                                                   \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->head_node = NULL;                                                                                                          \
+    list->tail_node = NULL;                                                                                                          \
+    list->length = 0;                                                                                                                \
+    list->print_data_function = print_data_function;                                                                                 \
+    list->free_data_function = free_data_function;                                                                                   \
+                                                                                                                                     \
+    return list;                                                                                                                     \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline name##_node *name##_create_node(T node_data)                                                                         \
+  {                                                                                                                                  \
+    name##_node *node = (name##_node *)malloc(sizeof(name##_node));                                                                  \
+                                                                                                                                     \
+    if (node == NULL)                                                                                                                \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node'.");           \
+                                                                                                                                     \
+      return NULL;                                                                                                                   \
+    }                                                                                                                                \
+                                                                                                                                     \
+    node->node_data = node_data;                                                                                                     \
+    node->next_node = NULL;                                                                                                          \
+                                                                                                                                     \
+    return node;                                                                                                                     \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline void name##_insert_node_at_head(name *list, T node_data)                                                             \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL singly linked list."); \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name##_node *new_node = name##_create_node(node_data);                                                                           \
+                                                                                                                                     \
+    if (new_node == NULL)                                                                                                            \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "An error occurred while creating a new node.");   \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    new_node->next_node = list->head_node;                                                                                           \
+    list->head_node = new_node;                                                                                                      \
+                                                                                                                                     \
+    if (list->tail_node == NULL)                                                                                                     \
+    {                                                                                                                                \
+      list->tail_node = new_node;                                                                                                    \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->length++;                                                                                                                  \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline void name##_insert_node_at_tail(name *list, T node_data)                                                             \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL singly linked list."); \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name##_node *new_node = name##_create_node(node_data);                                                                           \
+                                                                                                                                     \
+    if (new_node == NULL)                                                                                                            \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "An error occurred while creating a new node.");   \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    if (list->tail_node == NULL)                                                                                                     \
+    {                                                                                                                                \
+      list->head_node = new_node;                                                                                                    \
+    }                                                                                                                                \
+    else                                                                                                                             \
+    {                                                                                                                                \
+      list->tail_node->next_node = new_node;                                                                                         \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->tail_node = new_node;                                                                                                      \
+    list->length++;                                                                                                                  \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline void name##_print(name *list)                                                                                        \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL singly linked list.");            \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    for (name##_node *current_node = list->head_node; current_node != NULL;                                                          \
+         current_node = current_node->next_node)                                                                                     \
+    {                                                                                                                                \
+      list->print_data_function(current_node->node_data);                                                                            \
+    }                                                                                                                                \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline void name##_free(name *list)                                                                                         \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL singly linked list.");             \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name##_node *current_node = list->head_node;                                                                                     \
+    name##_node *next_node = NULL;                                                                                                   \
+                                                                                                                                     \
+    while (current_node != NULL)                                                                                                     \
+    {                                                                                                                                \
+      next_node = current_node->next_node;                                                                                           \
+                                                                                                                                     \
+      if (list->free_data_function != NULL)                                                                                          \
+      {                                                                                                                              \
+        list->free_data_function(current_node->node_data);                                                                           \
+      }                                                                                                                              \
+                                                                                                                                     \
+      free(current_node);                                                                                                            \
+                                                                                                                                     \
+      current_node = next_node;                                                                                                      \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->head_node = NULL;                                                                                                          \
+    list->tail_node = NULL;                                                                                                          \
+    list->length = 0;                                                                                                                \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline size_t name##_get_length(name *list)                                                                                 \
+  {                                                                                                                                  \
+    return name##_is_valid(list) ? list->length : 0;                                                                                 \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline void name##_reverse(name *list)                                                                                      \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL singly linked list.");          \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    if (list->head_node == NULL)                                                                                                     \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_EMPTY_LIST, "You cannot reverse an empty singly linked list.");       \
+                                                                                                                                     \
+      return;                                                                                                                        \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name##_node *previous_node = NULL;                                                                                               \
+    name##_node *current_node = list->head_node;                                                                                     \
+    name##_node *next_node = NULL;                                                                                                   \
+                                                                                                                                     \
+    while (current_node != NULL)                                                                                                     \
+    {                                                                                                                                \
+      next_node = current_node->next_node;                                                                                           \
+      current_node->next_node = previous_node;                                                                                       \
+      previous_node = current_node;                                                                                                  \
+      current_node = next_node;                                                                                                      \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->tail_node = list->head_node;                                                                                               \
+    list->head_node = previous_node;                                                                                                 \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline name##_node *name##_find_node_by_data(name *list, T node_data)                                                       \
+  {                                                                                                                                  \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search a node on a NULL singly linked list."); \
+                                                                                                                                     \
+      return NULL;                                                                                                                   \
+    }                                                                                                                                \
+                                                                                                                                     \
+    for (name##_node *current_node = list->head_node; current_node != NULL;                                                          \
+         current_node = current_node->next_node)                                                                                     \
+    {                                                                                                                                \
+      if (cmp(current_node->node_data, node_data))                                                                                   \
+      {                                                                                                                              \
+        return current_node;                                                                                                         \
+      }                                                                                                                              \
+    }                                                                                                                                \
+                                                                                                                                     \
+    return NULL;                                                                                                                     \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static inline size_t name##_delete_node_by_data(name *list, T node_data)                                                           \
+  {                                                                                                                                  \
+    size_t deleted_nodes_count = 0;                                                                                                  \
+                                                                                                                                     \
+    if (!name##_is_valid(list))                                                                                                      \
+    {                                                                                                                                \
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node on a NULL singly linked list."); \
+                                                                                                                                     \
+      return deleted_nodes_count;                                                                                                    \
+    }                                                                                                                                \
+                                                                                                                                     \
+    name##_node **link = &list->head_node;                                                                                           \
+    name##_node *previous_node = NULL;                                                                                               \
+                                                                                                                                     \
+    while (*link != NULL)                                                                                                            \
+    {                                                                                                                                \
+      name##_node *current_node = *link;                                                                                             \
+                                                                                                                                     \
+      if (cmp(current_node->node_data, node_data))                                                                                   \
+      {                                                                                                                              \
+        *link = current_node->next_node;                                                                                             \
+                                                                                                                                     \
+        if (list->free_data_function != NULL)                                                                                        \
+        {                                                                                                                            \
+          list->free_data_function(current_node->node_data);                                                                         \
+        }                                                                                                                            \
+                                                                                                                                     \
+        free(current_node);                                                                                                          \
+                                                                                                                                     \
+        deleted_nodes_count++;                                                                                                       \
+      }                                                                                                                              \
+      else                                                                                                                           \
+      {                                                                                                                              \
+        previous_node = current_node;                                                                                                \
+        link = &current_node->next_node;                                                                                             \
+      }                                                                                                                              \
+    }                                                                                                                                \
+                                                                                                                                     \
+    list->tail_node = previous_node;                                                                                                 \
+    list->length -= deleted_nodes_count;                                                                                             \
+                                                                                                                                     \
+    return deleted_nodes_count;                                                                                                      \
+  }
+
+#endif
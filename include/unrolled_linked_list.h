@@ -0,0 +1,175 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "singly_linked_list.h"
+
+/**
+ * \def UNROLLED_NODE_CACHE_LINE_SIZE
+ * \brief The alignment of every block of an unrolled linked list, and the size of a block by default.
+ */
+#ifndef UNROLLED_NODE_CACHE_LINE_SIZE
+#define UNROLLED_NODE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * \def UNROLLED_NODE_CAPACITY
+ * \brief The number of `NodeData` slots stored in every block of an unrolled linked list.
+ *
+ * By default the slots of a block, its slot count and its next block pointer fill exactly one aligned cache line,
+ * so a traversal takes one cache miss per block instead of one per element. It can be overridden at compile time,
+ * in which case a block spans as many whole cache lines as it needs.
+ */
+#ifndef UNROLLED_NODE_CAPACITY
+#define UNROLLED_NODE_CAPACITY ((UNROLLED_NODE_CACHE_LINE_SIZE - sizeof(size_t) - sizeof(void *)) / sizeof(NodeData))
+#endif
+
+/**
+ * \struct UnrolledNode
+ * \brief A structure representing a block of an unrolled linked list.
+ *
+ * This structure stores up to `UNROLLED_NODE_CAPACITY` pieces of data contiguously, followed by the number
+ * of slots in use and a pointer to the next block in the list, or `NULL` if there is no next block.
+ * The used slots are always packed at the beginning of the `node_data` array.
+ */
+typedef struct UnrolledNode
+{
+  _Alignas(UNROLLED_NODE_CACHE_LINE_SIZE) NodeData node_data[UNROLLED_NODE_CAPACITY]; /**< The data stored in the block. */
+  size_t data_count;                                                                  /**< Number of slots of `node_data` in use. */
+  struct UnrolledNode *next_node;                                                     /**< Pointer to the next block in the list. */
+} UnrolledNode;
+
+/**
+ * \struct UnrolledLinkedList
+ * \brief A structure representing an unrolled linked list.
+ *
+ * This structure represents a singly linked list of blocks, each holding several pieces of data, with a pointer
+ * to the head block, a pointer to the tail block, the total number of stored elements and the same function
+ * pointers as a `SinglyLinkedList` for printing, freeing, and comparing data.
+ */
+typedef struct UnrolledLinkedList
+{
+  UnrolledNode *head_node;                   /**< Pointer to the first block in the list. */
+  UnrolledNode *tail_node;                   /**< Pointer to the last block in the list. */
+  size_t length;                             /**< Number of elements currently in the list. */
+  PrintDataFunction print_data_function;     /**< Function pointer for printing node data. */
+  FreeDataFunction free_data_function;       /**< Function pointer for freeing node data. */
+  CompareDataFunction compare_data_function; /**< Function pointer for comparing node data. */
+} UnrolledLinkedList;
+
+/**
+ * \brief Creates a new unrolled linked list with the provided function pointers.
+ *
+ * This function allocates memory for a new `UnrolledLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing data. If any of the function
+ * pointers is NULL or the allocation fails, an error message is printed and the function returns `NULL`.
+ *
+ * \param print_data_function A function pointer used to print a piece of data.
+ * \param free_data_function A function pointer used to free a piece of data.
+ * \param compare_data_function A function pointer used to compare two pieces of data.
+ *
+ * \return A pointer to the newly created `UnrolledLinkedList` if successful, or `NULL` if an error occurs.
+ */
+UnrolledLinkedList *create_unrolled_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function);
+
+/**
+ * \brief Inserts data at the head of the unrolled linked list.
+ *
+ * If the head block has a free slot, the data already stored in it is shifted by one slot and the new
+ * data is placed first. Otherwise a new block is allocated and becomes the head of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` where the data will be inserted.
+ * \param node_data The data to be inserted. This cannot be `NULL`.
+ */
+void insert_data_at_unrolled_linked_list_head(UnrolledLinkedList *unrolled_linked_list, NodeData node_data);
+
+/**
+ * \brief Inserts data at the tail of the unrolled linked list.
+ *
+ * If the tail block has a free slot, the data is appended to it. Otherwise a new block is allocated
+ * and becomes the tail of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` where the data will be inserted.
+ * \param node_data The data to be inserted. This cannot be `NULL`.
+ */
+void insert_data_at_unrolled_linked_list_tail(UnrolledLinkedList *unrolled_linked_list, NodeData node_data);
+
+/**
+ * \brief Prints all the data in the unrolled linked list.
+ *
+ * This function iterates through every block starting from the head and prints each piece of data
+ * in order using the `print_data_function` provided during the creation of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` to be printed.
+ */
+void print_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list);
+
+/**
+ * \brief Frees all the blocks in the unrolled linked list and releases the memory.
+ *
+ * This function frees every piece of data using the `free_data_function` provided during the creation
+ * of the list, then frees the blocks themselves. Afterward, the list is empty.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` to be freed.
+ */
+void free_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list);
+
+/**
+ * \brief Returns the number of elements in the unrolled linked list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` whose length is to be returned.
+ *
+ * \return The number of elements in the list, or 0 if the list is invalid.
+ */
+size_t get_unrolled_linked_list_length(UnrolledLinkedList *unrolled_linked_list);
+
+/**
+ * \brief Reverses the order of elements in an unrolled linked list.
+ *
+ * This function reverses the order of the blocks and the order of the data inside every block,
+ * and swaps the head and tail blocks.
+ *
+ * \param unrolled_linked_list Pointer to the unrolled linked list to be reversed.
+ */
+void reverse_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list);
+
+/**
+ * \brief Searches for data in the unrolled linked list.
+ *
+ * This function compares every stored piece of data with the provided `node_data`, block by block,
+ * and returns the first one that matches.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list to search in.
+ * \param node_data The data to search for.
+ *
+ * \return The stored data that matches `node_data`, or `NULL` if there is no match.
+ */
+NodeData find_data_in_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list, NodeData node_data);
+
+/**
+ * \brief Checks if an unrolled linked list is valid.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list to be checked.
+ *
+ * \return true if the unrolled linked list is not NULL, false otherwise.
+ */
+bool is_valid_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list);
+
+/**
+ * \brief Deletes all the data in the unrolled linked list that matches the provided data.
+ *
+ * This function walks the list once, freeing every matching piece of data and packing the data that
+ * follows the first match towards the head, so that every block from the one holding the first match
+ * to the last one but one ends up full. Blocks left empty are freed and the tail pointer is adjusted.
+ * If nothing matches, the list is left untouched.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list from which data will be deleted.
+ * \param node_data The data to search for. Matching data will be deleted.
+ *
+ * \return The number of elements that were deleted from the list.
+ */
+size_t delete_data_from_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list, NodeData node_data);
+
+#endif
@@ -0,0 +1,481 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../include/compact_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief The capacity of the node arrays of a compact singly linked list after its first insertion.
+ */
+#define COMPACT_SINGLY_LINKED_LIST_INITIAL_CAPACITY 16
+
+/**
+ * \brief Creates a new empty compact singly linked list with the provided function pointers.
+ *
+ * This function allocates memory for a new `CompactSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing node data. No node array is allocated
+ * until the first insertion. If any of the function pointers is NULL or the allocation fails, an error is
+ * reported and the function returns `NULL`.
+ *
+ * \param print_data_function A function pointer used to print the data of a node.
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ *
+ * \return A pointer to the newly created `CompactSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+CompactSinglyLinkedList *create_compact_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
+{
+  if (print_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (free_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  CompactSinglyLinkedList *compact_singly_linked_list = (CompactSinglyLinkedList *)malloc(sizeof(CompactSinglyLinkedList));
+
+  if (compact_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'compact_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  compact_singly_linked_list->node_data_array = NULL;
+  compact_singly_linked_list->next_index_array = NULL;
+  compact_singly_linked_list->capacity = 0;
+  compact_singly_linked_list->used_count = 0;
+  compact_singly_linked_list->free_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->head_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->tail_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->length = 0;
+  compact_singly_linked_list->print_data_function = print_data_function;
+  compact_singly_linked_list->free_data_function = free_data_function;
+  compact_singly_linked_list->compare_data_function = compare_data_function;
+
+  return compact_singly_linked_list;
+}
+
+/**
+ * \brief Grows the node arrays of the compact singly linked list to hold at least the provided number of nodes.
+ *
+ * The arrays are never shrunk. Reserving the final size up front avoids both the copies made while doubling
+ * and the unused slots left by the last doubling.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be grown.
+ * \param capacity The number of nodes the arrays must be able to hold, up to `COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY`.
+ *
+ * \return true if the arrays can hold `capacity` nodes, false if an error occurred and they were left untouched.
+ */
+bool reserve_compact_singly_linked_list_capacity(CompactSinglyLinkedList *compact_singly_linked_list, size_t capacity)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reserve capacity for a NULL compact singly linked list.");
+
+    return false;
+  }
+
+  if (capacity <= compact_singly_linked_list->capacity)
+  {
+    return true;
+  }
+
+  if (capacity > COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY || capacity > SIZE_MAX / sizeof(NodeData))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED, "A compact singly linked list cannot hold that many nodes.");
+
+    return false;
+  }
+
+  NodeData *node_data_array = (NodeData *)realloc(compact_singly_linked_list->node_data_array, capacity * sizeof(NodeData));
+
+  if (node_data_array == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node_data_array'.");
+
+    return false;
+  }
+
+  compact_singly_linked_list->node_data_array = node_data_array;
+
+  uint32_t *next_index_array = (uint32_t *)realloc(compact_singly_linked_list->next_index_array, capacity * sizeof(uint32_t));
+
+  if (next_index_array == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'next_index_array'.");
+
+    return false;
+  }
+
+  compact_singly_linked_list->next_index_array = next_index_array;
+  compact_singly_linked_list->capacity = capacity;
+
+  return true;
+}
+
+/**
+ * \brief Takes a slot for a new node from the free index list, or from the unused part of the arrays.
+ *
+ * The arrays are doubled when every slot has been handed out and none has been released.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` the node will belong to.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return The index of the new node, whose next index is not set, or `COMPACT_NODE_NULL_INDEX` if an error occurs.
+ */
+static uint32_t allocate_compact_node(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data)
+{
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot create a new node with a NULL value.");
+
+    return COMPACT_NODE_NULL_INDEX;
+  }
+
+  uint32_t node_index = compact_singly_linked_list->free_index;
+
+  if (node_index != COMPACT_NODE_NULL_INDEX)
+  {
+    compact_singly_linked_list->free_index = compact_singly_linked_list->next_index_array[node_index];
+  }
+  else
+  {
+    if (compact_singly_linked_list->used_count == compact_singly_linked_list->capacity)
+    {
+      size_t capacity = compact_singly_linked_list->capacity;
+      size_t new_capacity = capacity == 0 ? COMPACT_SINGLY_LINKED_LIST_INITIAL_CAPACITY : capacity * 2;
+
+      if (new_capacity > COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY)
+      {
+        new_capacity = COMPACT_SINGLY_LINKED_LIST_MAX_CAPACITY;
+      }
+
+      if (new_capacity == capacity)
+      {
+        REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED, "A compact singly linked list cannot hold that many nodes.");
+
+        return COMPACT_NODE_NULL_INDEX;
+      }
+
+      if (!reserve_compact_singly_linked_list_capacity(compact_singly_linked_list, new_capacity))
+      {
+        return COMPACT_NODE_NULL_INDEX;
+      }
+    }
+
+    node_index = (uint32_t)compact_singly_linked_list->used_count++;
+  }
+
+  compact_singly_linked_list->node_data_array[node_index] = node_data;
+
+  return node_index;
+}
+
+/**
+ * \brief Frees the data of a node and pushes its slot onto the free index list.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` the node belongs to.
+ * \param node_index The index of the node to be released.
+ */
+static void release_compact_node(CompactSinglyLinkedList *compact_singly_linked_list, uint32_t node_index)
+{
+  compact_singly_linked_list->free_data_function(compact_singly_linked_list->node_data_array[node_index]);
+
+  compact_singly_linked_list->node_data_array[node_index] = NULL;
+  compact_singly_linked_list->next_index_array[node_index] = compact_singly_linked_list->free_index;
+  compact_singly_linked_list->free_index = node_index;
+}
+
+/**
+ * \brief Inserts a new node at the head of the compact singly linked list.
+ *
+ * The node reuses a released slot if there is one, and otherwise takes the next unused slot of the arrays,
+ * which are doubled when they are full.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_at_compact_singly_linked_list_head(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL compact singly linked list.");
+
+    return;
+  }
+
+  uint32_t new_index = allocate_compact_node(compact_singly_linked_list, node_data);
+
+  if (new_index == COMPACT_NODE_NULL_INDEX)
+  {
+    return;
+  }
+
+  compact_singly_linked_list->next_index_array[new_index] = compact_singly_linked_list->head_index;
+  compact_singly_linked_list->head_index = new_index;
+
+  if (compact_singly_linked_list->tail_index == COMPACT_NODE_NULL_INDEX)
+  {
+    compact_singly_linked_list->tail_index = new_index;
+  }
+
+  compact_singly_linked_list->length++;
+}
+
+/**
+ * \brief Inserts a new node at the tail of the compact singly linked list.
+ *
+ * The node reuses a released slot if there is one, and otherwise takes the next unused slot of the arrays,
+ * which are doubled when they are full.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_at_compact_singly_linked_list_tail(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL compact singly linked list.");
+
+    return;
+  }
+
+  uint32_t new_index = allocate_compact_node(compact_singly_linked_list, node_data);
+
+  if (new_index == COMPACT_NODE_NULL_INDEX)
+  {
+    return;
+  }
+
+  compact_singly_linked_list->next_index_array[new_index] = COMPACT_NODE_NULL_INDEX;
+
+  if (compact_singly_linked_list->tail_index == COMPACT_NODE_NULL_INDEX)
+  {
+    compact_singly_linked_list->head_index = new_index;
+  }
+  else
+  {
+    compact_singly_linked_list->next_index_array[compact_singly_linked_list->tail_index] = new_index;
+  }
+
+  compact_singly_linked_list->tail_index = new_index;
+  compact_singly_linked_list->length++;
+}
+
+/**
+ * \brief Prints all the nodes in the compact singly linked list, from head to tail.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be printed.
+ */
+void print_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL compact singly linked list.");
+
+    return;
+  }
+
+  for (uint32_t node_index = compact_singly_linked_list->head_index; node_index != COMPACT_NODE_NULL_INDEX; node_index = compact_singly_linked_list->next_index_array[node_index])
+  {
+    compact_singly_linked_list->print_data_function(compact_singly_linked_list->node_data_array[node_index]);
+  }
+}
+
+/**
+ * \brief Frees the data of all the nodes in the compact singly linked list, releases its arrays and leaves it empty.
+ *
+ * The list structure itself is not freed.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be freed.
+ */
+void free_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL compact singly linked list.");
+
+    return;
+  }
+
+  for (uint32_t node_index = compact_singly_linked_list->head_index; node_index != COMPACT_NODE_NULL_INDEX; node_index = compact_singly_linked_list->next_index_array[node_index])
+  {
+    compact_singly_linked_list->free_data_function(compact_singly_linked_list->node_data_array[node_index]);
+  }
+
+  free(compact_singly_linked_list->node_data_array);
+  free(compact_singly_linked_list->next_index_array);
+
+  compact_singly_linked_list->node_data_array = NULL;
+  compact_singly_linked_list->next_index_array = NULL;
+  compact_singly_linked_list->capacity = 0;
+  compact_singly_linked_list->used_count = 0;
+  compact_singly_linked_list->free_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->head_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->tail_index = COMPACT_NODE_NULL_INDEX;
+  compact_singly_linked_list->length = 0;
+}
+
+/**
+ * \brief Returns the number of nodes in the compact singly linked list in constant time.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_compact_singly_linked_list_length(CompactSinglyLinkedList *compact_singly_linked_list)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    return 0;
+  }
+
+  return compact_singly_linked_list->length;
+}
+
+/**
+ * \brief Reverses the order of the nodes in the compact singly linked list by rewriting their next indices.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be reversed.
+ */
+void reverse_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL compact singly linked list.");
+
+    return;
+  }
+
+  uint32_t *next_index_array = compact_singly_linked_list->next_index_array;
+  uint32_t previous_index = COMPACT_NODE_NULL_INDEX;
+  uint32_t current_index = compact_singly_linked_list->head_index;
+
+  while (current_index != COMPACT_NODE_NULL_INDEX)
+  {
+    uint32_t next_index = next_index_array[current_index];
+
+    next_index_array[current_index] = previous_index;
+    previous_index = current_index;
+    current_index = next_index;
+  }
+
+  compact_singly_linked_list->tail_index = compact_singly_linked_list->head_index;
+  compact_singly_linked_list->head_index = previous_index;
+}
+
+/**
+ * \brief Searches for the first node of the compact singly linked list whose data matches the provided data.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to search in.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The index of the matching node, whose data is `node_data_array[index]`, or `COMPACT_NODE_NULL_INDEX`
+ * if no node is found.
+ */
+uint32_t find_node_in_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for a node in a NULL compact singly linked list.");
+
+    return COMPACT_NODE_NULL_INDEX;
+  }
+
+  for (uint32_t node_index = compact_singly_linked_list->head_index; node_index != COMPACT_NODE_NULL_INDEX; node_index = compact_singly_linked_list->next_index_array[node_index])
+  {
+    if (compact_singly_linked_list->compare_data_function(compact_singly_linked_list->node_data_array[node_index], node_data))
+    {
+      return node_index;
+    }
+  }
+
+  return COMPACT_NODE_NULL_INDEX;
+}
+
+/**
+ * \brief Checks if a compact singly linked list is valid.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` to be checked.
+ *
+ * \return true if the compact singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list)
+{
+  return compact_singly_linked_list != NULL;
+}
+
+/**
+ * \brief Deletes every node of the compact singly linked list whose data matches the provided data.
+ *
+ * The data of the deleted nodes is freed and their slots are pushed onto the free index list for reuse.
+ *
+ * \param compact_singly_linked_list A pointer to the `CompactSinglyLinkedList` from which nodes will be deleted.
+ * \param node_data The data to search for in the list. Nodes with matching data will be deleted.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_node_from_compact_singly_linked_list(CompactSinglyLinkedList *compact_singly_linked_list, NodeData node_data)
+{
+  if (!is_valid_compact_singly_linked_list(compact_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node on a NULL compact singly linked list.");
+
+    return 0;
+  }
+
+  uint32_t *next_index_array = compact_singly_linked_list->next_index_array;
+  size_t deleted_nodes_count = 0;
+  uint32_t previous_index = COMPACT_NODE_NULL_INDEX;
+  uint32_t current_index = compact_singly_linked_list->head_index;
+
+  while (current_index != COMPACT_NODE_NULL_INDEX)
+  {
+    uint32_t next_index = next_index_array[current_index];
+
+    if (compact_singly_linked_list->compare_data_function(compact_singly_linked_list->node_data_array[current_index], node_data))
+    {
+      if (previous_index == COMPACT_NODE_NULL_INDEX)
+      {
+        compact_singly_linked_list->head_index = next_index;
+      }
+      else
+      {
+        next_index_array[previous_index] = next_index;
+      }
+
+      if (next_index == COMPACT_NODE_NULL_INDEX)
+      {
+        compact_singly_linked_list->tail_index = previous_index;
+      }
+
+      release_compact_node(compact_singly_linked_list, current_index);
+
+      compact_singly_linked_list->length--;
+      deleted_nodes_count++;
+    }
+    else
+    {
+      previous_index = current_index;
+    }
+
+    current_index = next_index;
+  }
+
+  return deleted_nodes_count;
+}
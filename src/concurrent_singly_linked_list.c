@@ -0,0 +1,247 @@
+#include <stdlib.h>
+
+#include "../include/concurrent_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Frees a node retired from a concurrent singly linked list.
+ *
+ * The data of the node is not freed, since it was handed to the thread that removed the node.
+ *
+ * \param node A pointer to the retired node.
+ */
+static void reclaim_concurrent_node(void *node)
+{
+  free(node);
+}
+
+/**
+ * \brief Creates a new concurrent singly linked list.
+ *
+ * This function allocates memory for a new `ConcurrentSinglyLinkedList` and initializes its hazard
+ * pointer domain. If `free_data_function` is NULL or the allocation fails, an error message is printed
+ * and the function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ *
+ * \return A pointer to the newly created `ConcurrentSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+ConcurrentSinglyLinkedList *create_concurrent_singly_linked_list(FreeDataFunction free_data_function)
+{
+  if (free_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  ConcurrentSinglyLinkedList *concurrent_singly_linked_list = (ConcurrentSinglyLinkedList *)aligned_alloc(_Alignof(ConcurrentSinglyLinkedList), sizeof(ConcurrentSinglyLinkedList));
+
+  if (concurrent_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'concurrent_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  atomic_init(&concurrent_singly_linked_list->head_node, NULL);
+  atomic_init(&concurrent_singly_linked_list->length, 0);
+
+  concurrent_singly_linked_list->free_data_function = free_data_function;
+
+  initialize_hazard_pointer_domain(&concurrent_singly_linked_list->hazard_pointer_domain, reclaim_concurrent_node);
+
+  return concurrent_singly_linked_list;
+}
+
+/**
+ * \brief Registers the calling thread with a concurrent singly linked list.
+ *
+ * Every thread that removes nodes from the list needs its own hazard pointer record, which it passes
+ * to `pop_node_from_concurrent_head` and gives back with `unregister_concurrent_singly_linked_list_thread`.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list the thread will use.
+ *
+ * \return A pointer to the hazard pointer record of the thread, or `NULL` if none is available.
+ */
+HazardPointerRecord *register_concurrent_singly_linked_list_thread(ConcurrentSinglyLinkedList *concurrent_singly_linked_list)
+{
+  if (concurrent_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot register a thread on a NULL concurrent singly linked list.");
+
+    return NULL;
+  }
+
+  return acquire_hazard_pointer_record(&concurrent_singly_linked_list->hazard_pointer_domain);
+}
+
+/**
+ * \brief Gives back the hazard pointer record of a thread that no longer uses the list.
+ *
+ * \param hazard_pointer_record A pointer to the record returned by `register_concurrent_singly_linked_list_thread`.
+ */
+void unregister_concurrent_singly_linked_list_thread(HazardPointerRecord *hazard_pointer_record)
+{
+  if (hazard_pointer_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot unregister a NULL hazard pointer record.");
+
+    return;
+  }
+
+  release_hazard_pointer_record(hazard_pointer_record);
+}
+
+/**
+ * \brief Inserts a new node at the head of the concurrent singly linked list.
+ *
+ * This function creates a new node with `create_node` and publishes it with a compare-and-swap loop on
+ * `head_node`, so it can be called by any number of threads at the same time without a lock.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_at_concurrent_head(ConcurrentSinglyLinkedList *concurrent_singly_linked_list, NodeData node_data)
+{
+  if (concurrent_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL concurrent singly linked list.");
+
+    return false;
+  }
+
+  Node *new_node = create_node(node_data);
+
+  if (new_node == NULL)
+  {
+    return false;
+  }
+
+  atomic_fetch_add_explicit(&concurrent_singly_linked_list->length, 1, memory_order_relaxed);
+
+  new_node->next_node = atomic_load_explicit(&concurrent_singly_linked_list->head_node, memory_order_relaxed);
+
+  while (!atomic_compare_exchange_weak_explicit(&concurrent_singly_linked_list->head_node, &new_node->next_node, new_node, memory_order_release, memory_order_relaxed))
+  {
+  }
+
+  return true;
+}
+
+/**
+ * \brief Removes the node at the head of the concurrent singly linked list and returns its data.
+ *
+ * This function protects the current head with a hazard pointer, then swings `head_node` to the next
+ * node with a compare-and-swap. The removed node is retired and freed once no other thread holds it as
+ * a hazard pointer. The ownership of the returned data passes to the caller.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list to remove the node from.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ *
+ * \return The data of the removed node, or `NULL` if the list is empty.
+ */
+NodeData pop_node_from_concurrent_head(ConcurrentSinglyLinkedList *concurrent_singly_linked_list, HazardPointerRecord *hazard_pointer_record)
+{
+  if (concurrent_singly_linked_list == NULL || hazard_pointer_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot remove a node without a concurrent singly linked list and a hazard pointer record.");
+
+    return NULL;
+  }
+
+  Node *head_node = atomic_load_explicit(&concurrent_singly_linked_list->head_node, memory_order_acquire);
+
+  while (head_node != NULL)
+  {
+    set_hazard_pointer(hazard_pointer_record, 0, head_node);
+
+    Node *current_head_node = atomic_load_explicit(&concurrent_singly_linked_list->head_node, memory_order_seq_cst);
+
+    if (current_head_node != head_node)
+    {
+      head_node = current_head_node;
+
+      continue;
+    }
+
+    if (atomic_compare_exchange_strong_explicit(&concurrent_singly_linked_list->head_node, &head_node, head_node->next_node, memory_order_acq_rel, memory_order_acquire))
+    {
+      break;
+    }
+  }
+
+  set_hazard_pointer(hazard_pointer_record, 0, NULL);
+
+  if (head_node == NULL)
+  {
+    return NULL;
+  }
+
+  NodeData node_data = head_node->node_data;
+
+  atomic_fetch_sub_explicit(&concurrent_singly_linked_list->length, 1, memory_order_relaxed);
+
+  retire_hazard_pointer(&concurrent_singly_linked_list->hazard_pointer_domain, hazard_pointer_record, head_node);
+
+  return node_data;
+}
+
+/**
+ * \brief Returns the number of nodes in the concurrent singly linked list.
+ *
+ * The count is approximate: it is incremented before a node is linked and decremented after one is unlinked,
+ * so while other threads modify the list it can be briefly above the number of reachable nodes, but never below.
+ * It is exact once no thread is modifying the list.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_concurrent_singly_linked_list_length(ConcurrentSinglyLinkedList *concurrent_singly_linked_list)
+{
+  if (concurrent_singly_linked_list == NULL)
+  {
+    return 0;
+  }
+
+  return atomic_load_explicit(&concurrent_singly_linked_list->length, memory_order_relaxed);
+}
+
+/**
+ * \brief Frees all the nodes of the concurrent singly linked list and every node still retired.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty.
+ *
+ * \param concurrent_singly_linked_list A pointer to the list to be freed.
+ */
+void free_concurrent_singly_linked_list(ConcurrentSinglyLinkedList *concurrent_singly_linked_list)
+{
+  if (concurrent_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL concurrent singly linked list.");
+
+    return;
+  }
+
+  Node *current_node = atomic_load_explicit(&concurrent_singly_linked_list->head_node, memory_order_acquire);
+  Node *next_node = NULL;
+
+  while (current_node != NULL)
+  {
+    next_node = current_node->next_node;
+
+    concurrent_singly_linked_list->free_data_function(current_node->node_data);
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  destroy_hazard_pointer_domain(&concurrent_singly_linked_list->hazard_pointer_domain);
+
+  atomic_store_explicit(&concurrent_singly_linked_list->head_node, NULL, memory_order_relaxed);
+  atomic_store_explicit(&concurrent_singly_linked_list->length, 0, memory_order_relaxed);
+}
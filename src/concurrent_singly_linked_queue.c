@@ -0,0 +1,317 @@
+#include <stdlib.h>
+
+#include "../include/concurrent_singly_linked_queue.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Frees a sentinel node retired from a concurrent singly linked queue.
+ *
+ * The data of the node is not freed, since it was handed to the thread that dequeued it.
+ *
+ * \param node A pointer to the retired node.
+ */
+static void reclaim_concurrent_queue_node(void *node)
+{
+  free(node);
+}
+
+/**
+ * \brief Creates a new node for a concurrent singly linked queue.
+ *
+ * Unlike `create_node`, this function accepts `NULL` data, which is only used for the initial sentinel.
+ *
+ * \param node_data The data to be stored in the new node.
+ *
+ * \return A pointer to the newly created `ConcurrentQueueNode` if successful, or `NULL` if the allocation fails.
+ */
+static ConcurrentQueueNode *create_concurrent_queue_node(NodeData node_data)
+{
+  ConcurrentQueueNode *node = (ConcurrentQueueNode *)malloc(sizeof(ConcurrentQueueNode));
+
+  if (node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node'.");
+
+    return NULL;
+  }
+
+  node->node_data = node_data;
+
+  atomic_init(&node->next_node, NULL);
+
+  return node;
+}
+
+/**
+ * \brief Creates a new concurrent singly linked queue.
+ *
+ * This function allocates memory for a new `ConcurrentSinglyLinkedQueue` and its sentinel node, and
+ * initializes its hazard pointer domain. If `free_data_function` is NULL or an allocation fails, an error
+ * message is printed and the function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ *
+ * \return A pointer to the newly created `ConcurrentSinglyLinkedQueue` if successful, or `NULL` if an error occurs.
+ */
+ConcurrentSinglyLinkedQueue *create_concurrent_singly_linked_queue(FreeDataFunction free_data_function)
+{
+  if (free_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue = (ConcurrentSinglyLinkedQueue *)aligned_alloc(_Alignof(ConcurrentSinglyLinkedQueue), sizeof(ConcurrentSinglyLinkedQueue));
+
+  if (concurrent_singly_linked_queue == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'concurrent_singly_linked_queue'.");
+
+    return NULL;
+  }
+
+  ConcurrentQueueNode *sentinel_node = create_concurrent_queue_node(NULL);
+
+  if (sentinel_node == NULL)
+  {
+    free(concurrent_singly_linked_queue);
+
+    return NULL;
+  }
+
+  atomic_init(&concurrent_singly_linked_queue->head_node, sentinel_node);
+  atomic_init(&concurrent_singly_linked_queue->tail_node, sentinel_node);
+
+  concurrent_singly_linked_queue->free_data_function = free_data_function;
+
+  initialize_hazard_pointer_domain(&concurrent_singly_linked_queue->hazard_pointer_domain, reclaim_concurrent_queue_node);
+
+  return concurrent_singly_linked_queue;
+}
+
+/**
+ * \brief Registers the calling thread with a concurrent singly linked queue.
+ *
+ * Every thread that uses the queue needs its own hazard pointer record, which it passes to `enqueue_node_data`
+ * and `dequeue_node_data` and gives back with `unregister_concurrent_singly_linked_queue_thread`.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue the thread will use.
+ *
+ * \return A pointer to the hazard pointer record of the thread, or `NULL` if none is available.
+ */
+HazardPointerRecord *register_concurrent_singly_linked_queue_thread(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue)
+{
+  if (concurrent_singly_linked_queue == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot register a thread on a NULL concurrent singly linked queue.");
+
+    return NULL;
+  }
+
+  return acquire_hazard_pointer_record(&concurrent_singly_linked_queue->hazard_pointer_domain);
+}
+
+/**
+ * \brief Gives back the hazard pointer record of a thread that no longer uses the queue.
+ *
+ * \param hazard_pointer_record A pointer to the record returned by `register_concurrent_singly_linked_queue_thread`.
+ */
+void unregister_concurrent_singly_linked_queue_thread(HazardPointerRecord *hazard_pointer_record)
+{
+  if (hazard_pointer_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot unregister a NULL hazard pointer record.");
+
+    return;
+  }
+
+  release_hazard_pointer_record(hazard_pointer_record);
+}
+
+/**
+ * \brief Appends data at the tail of the concurrent singly linked queue.
+ *
+ * This function links a new node after the last node with a compare-and-swap on its `next_node`, then
+ * tries to swing `tail_node` to it. If the tail is lagging behind, it is advanced first.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue where the data will be appended.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ * \param node_data The data to be enqueued. This cannot be `NULL`.
+ *
+ * \return true if the data was enqueued, false if an error occurred.
+ */
+bool enqueue_node_data(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue, HazardPointerRecord *hazard_pointer_record, NodeData node_data)
+{
+  if (concurrent_singly_linked_queue == NULL || hazard_pointer_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot enqueue data without a concurrent singly linked queue and a hazard pointer record.");
+
+    return false;
+  }
+
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot enqueue a NULL value.");
+
+    return false;
+  }
+
+  ConcurrentQueueNode *new_node = create_concurrent_queue_node(node_data);
+
+  if (new_node == NULL)
+  {
+    return false;
+  }
+
+  while (true)
+  {
+    ConcurrentQueueNode *tail_node = atomic_load_explicit(&concurrent_singly_linked_queue->tail_node, memory_order_acquire);
+
+    set_hazard_pointer(hazard_pointer_record, 0, tail_node);
+
+    if (tail_node != atomic_load_explicit(&concurrent_singly_linked_queue->tail_node, memory_order_seq_cst))
+    {
+      continue;
+    }
+
+    ConcurrentQueueNode *next_node = atomic_load_explicit(&tail_node->next_node, memory_order_acquire);
+
+    if (next_node != NULL)
+    {
+      atomic_compare_exchange_weak_explicit(&concurrent_singly_linked_queue->tail_node, &tail_node, next_node, memory_order_release, memory_order_relaxed);
+
+      continue;
+    }
+
+    if (atomic_compare_exchange_weak_explicit(&tail_node->next_node, &next_node, new_node, memory_order_release, memory_order_relaxed))
+    {
+      atomic_compare_exchange_strong_explicit(&concurrent_singly_linked_queue->tail_node, &tail_node, new_node, memory_order_release, memory_order_relaxed);
+
+      break;
+    }
+  }
+
+  set_hazard_pointer(hazard_pointer_record, 0, NULL);
+
+  return true;
+}
+
+/**
+ * \brief Removes the data at the front of the concurrent singly linked queue.
+ *
+ * This function moves `head_node` to the node following the current sentinel, which becomes the new
+ * sentinel, and returns its data. The previous sentinel is retired. The ownership of the returned data
+ * passes to the caller.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue to remove the data from.
+ * \param hazard_pointer_record A pointer to the hazard pointer record of the calling thread.
+ *
+ * \return The data at the front of the queue, or `NULL` if the queue is empty.
+ */
+NodeData dequeue_node_data(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue, HazardPointerRecord *hazard_pointer_record)
+{
+  if (concurrent_singly_linked_queue == NULL || hazard_pointer_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot dequeue data without a concurrent singly linked queue and a hazard pointer record.");
+
+    return NULL;
+  }
+
+  ConcurrentQueueNode *head_node = NULL;
+  NodeData node_data = NULL;
+
+  while (true)
+  {
+    head_node = atomic_load_explicit(&concurrent_singly_linked_queue->head_node, memory_order_acquire);
+
+    set_hazard_pointer(hazard_pointer_record, 0, head_node);
+
+    if (head_node != atomic_load_explicit(&concurrent_singly_linked_queue->head_node, memory_order_seq_cst))
+    {
+      continue;
+    }
+
+    ConcurrentQueueNode *tail_node = atomic_load_explicit(&concurrent_singly_linked_queue->tail_node, memory_order_acquire);
+    ConcurrentQueueNode *next_node = atomic_load_explicit(&head_node->next_node, memory_order_acquire);
+
+    set_hazard_pointer(hazard_pointer_record, 1, next_node);
+
+    if (head_node != atomic_load_explicit(&concurrent_singly_linked_queue->head_node, memory_order_seq_cst))
+    {
+      continue;
+    }
+
+    if (next_node == NULL)
+    {
+      head_node = NULL;
+
+      break;
+    }
+
+    if (head_node == tail_node)
+    {
+      atomic_compare_exchange_weak_explicit(&concurrent_singly_linked_queue->tail_node, &tail_node, next_node, memory_order_release, memory_order_relaxed);
+
+      continue;
+    }
+
+    node_data = next_node->node_data;
+
+    if (atomic_compare_exchange_weak_explicit(&concurrent_singly_linked_queue->head_node, &head_node, next_node, memory_order_acq_rel, memory_order_relaxed))
+    {
+      break;
+    }
+  }
+
+  set_hazard_pointer(hazard_pointer_record, 0, NULL);
+  set_hazard_pointer(hazard_pointer_record, 1, NULL);
+
+  if (head_node == NULL)
+  {
+    return NULL;
+  }
+
+  retire_hazard_pointer(&concurrent_singly_linked_queue->hazard_pointer_domain, hazard_pointer_record, head_node);
+
+  return node_data;
+}
+
+/**
+ * \brief Frees every node of the concurrent singly linked queue, including the sentinel.
+ *
+ * No thread may be using the queue while it is freed. Afterward, the queue must not be used again.
+ *
+ * \param concurrent_singly_linked_queue A pointer to the queue to be freed.
+ */
+void free_concurrent_singly_linked_queue(ConcurrentSinglyLinkedQueue *concurrent_singly_linked_queue)
+{
+  if (concurrent_singly_linked_queue == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL concurrent singly linked queue.");
+
+    return;
+  }
+
+  ConcurrentQueueNode *sentinel_node = atomic_load_explicit(&concurrent_singly_linked_queue->head_node, memory_order_acquire);
+  ConcurrentQueueNode *current_node = atomic_load_explicit(&sentinel_node->next_node, memory_order_acquire);
+  ConcurrentQueueNode *next_node = NULL;
+
+  free(sentinel_node);
+
+  while (current_node != NULL)
+  {
+    next_node = atomic_load_explicit(&current_node->next_node, memory_order_acquire);
+
+    concurrent_singly_linked_queue->free_data_function(current_node->node_data);
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  destroy_hazard_pointer_domain(&concurrent_singly_linked_queue->hazard_pointer_domain);
+
+  atomic_store_explicit(&concurrent_singly_linked_queue->head_node, NULL, memory_order_relaxed);
+  atomic_store_explicit(&concurrent_singly_linked_queue->tail_node, NULL, memory_order_relaxed);
+}
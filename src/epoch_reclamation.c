@@ -0,0 +1,343 @@
+#include <sched.h>
+#include <stdlib.h>
+
+#include "../include/epoch_reclamation.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Initializes an epoch domain.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to be initialized.
+ * \param reclaim_function A function pointer used to release retired pointers. This cannot be `NULL`.
+ */
+void initialize_epoch_domain(EpochDomain *epoch_domain, ReclaimFunction reclaim_function)
+{
+  for (size_t record_index = 0; record_index < EPOCH_RECLAMATION_MAX_RECORDS; record_index++)
+  {
+    EpochRecord *epoch_record = &epoch_domain->records[record_index];
+
+    atomic_init(&epoch_record->announced_epoch, 0);
+    atomic_init(&epoch_record->is_active, false);
+
+    epoch_record->critical_section_depth = 0;
+    epoch_record->pending_retired_count = 0;
+
+    for (size_t batch_index = 0; batch_index < EPOCH_RECLAMATION_BATCH_COUNT; batch_index++)
+    {
+      EpochRetiredBatch *retired_batch = &epoch_record->retired_batches[batch_index];
+
+      retired_batch->retired_pointers = NULL;
+      retired_batch->retired_count = 0;
+      retired_batch->retired_capacity = 0;
+      retired_batch->retire_epoch = 0;
+    }
+  }
+
+  atomic_init(&epoch_domain->global_epoch, 0);
+
+  epoch_domain->reclaim_function = reclaim_function;
+}
+
+/**
+ * \brief Releases every pointer of a batch with the `reclaim_function` of the domain and empties the batch.
+ *
+ * The array of the batch is kept, so that the next epoch with the same index reuses it.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the batch belongs to.
+ * \param retired_batch A pointer to the batch to be reclaimed.
+ */
+static void reclaim_epoch_retired_batch(EpochDomain *epoch_domain, EpochRetiredBatch *retired_batch)
+{
+  for (size_t retired_index = 0; retired_index < retired_batch->retired_count; retired_index++)
+  {
+    epoch_domain->reclaim_function(retired_batch->retired_pointers[retired_index]);
+  }
+
+  retired_batch->retired_count = 0;
+}
+
+/**
+ * \brief Releases every pointer still retired in the domain and the memory used by its records.
+ *
+ * No thread may be using the domain while it is destroyed.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to be destroyed.
+ */
+void destroy_epoch_domain(EpochDomain *epoch_domain)
+{
+  for (size_t record_index = 0; record_index < EPOCH_RECLAMATION_MAX_RECORDS; record_index++)
+  {
+    EpochRecord *epoch_record = &epoch_domain->records[record_index];
+
+    for (size_t batch_index = 0; batch_index < EPOCH_RECLAMATION_BATCH_COUNT; batch_index++)
+    {
+      EpochRetiredBatch *retired_batch = &epoch_record->retired_batches[batch_index];
+
+      reclaim_epoch_retired_batch(epoch_domain, retired_batch);
+
+      free(retired_batch->retired_pointers);
+
+      retired_batch->retired_pointers = NULL;
+      retired_batch->retired_capacity = 0;
+    }
+
+    epoch_record->pending_retired_count = 0;
+  }
+}
+
+/**
+ * \brief Acquires an unused record of the domain for the calling thread.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` to acquire the record from.
+ *
+ * \return A pointer to the acquired record, or `NULL` if all `EPOCH_RECLAMATION_MAX_RECORDS` records are in use.
+ */
+EpochRecord *acquire_epoch_record(EpochDomain *epoch_domain)
+{
+  for (size_t record_index = 0; record_index < EPOCH_RECLAMATION_MAX_RECORDS; record_index++)
+  {
+    EpochRecord *epoch_record = &epoch_domain->records[record_index];
+    bool is_active = false;
+
+    if (atomic_compare_exchange_strong_explicit(&epoch_record->is_active, &is_active, true, memory_order_acquire, memory_order_relaxed))
+    {
+      return epoch_record;
+    }
+  }
+
+  REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED, "All epoch records are in use.");
+
+  return NULL;
+}
+
+/**
+ * \brief Gives a record back to the domain.
+ *
+ * The owning thread must have left every critical section. The pointers retired through the record stay
+ * in it and are reclaimed by its next owner or when the domain is destroyed.
+ *
+ * \param epoch_record A pointer to the record to be released.
+ */
+void release_epoch_record(EpochRecord *epoch_record)
+{
+  epoch_record->critical_section_depth = 0;
+
+  atomic_store_explicit(&epoch_record->announced_epoch, 0, memory_order_release);
+  atomic_store_explicit(&epoch_record->is_active, false, memory_order_release);
+}
+
+/**
+ * \brief Enters a critical section, during which the pointers read from the shared structure stay valid.
+ *
+ * Entering costs a store of the announced epoch and a fence, and no write to memory shared with other
+ * readers. Critical sections can be nested, in which case only the outermost one announces the epoch.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record of the calling thread.
+ */
+void enter_epoch_critical_section(EpochDomain *epoch_domain, EpochRecord *epoch_record)
+{
+  if (epoch_record->critical_section_depth++ > 0)
+  {
+    return;
+  }
+
+  size_t global_epoch = atomic_load_explicit(&epoch_domain->global_epoch, memory_order_relaxed);
+
+  atomic_store_explicit(&epoch_record->announced_epoch, 2 * global_epoch + 1, memory_order_relaxed);
+
+  /* The announcement must be visible to the threads advancing the epoch before any shared pointer is read. */
+  atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * \brief Leaves a critical section entered with `enter_epoch_critical_section`.
+ *
+ * Once the outermost critical section is left, no pointer read during it may be used anymore.
+ *
+ * \param epoch_record A pointer to the record of the calling thread.
+ */
+void exit_epoch_critical_section(EpochRecord *epoch_record)
+{
+  if (--epoch_record->critical_section_depth > 0)
+  {
+    return;
+  }
+
+  atomic_store_explicit(&epoch_record->announced_epoch, 0, memory_order_release);
+}
+
+/**
+ * \brief Advances the global epoch of the domain if every thread inside a critical section has observed it.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` whose epoch is to be advanced.
+ *
+ * \return true if the global epoch has advanced since the call started, false if a thread still lags behind.
+ */
+bool try_advance_epoch(EpochDomain *epoch_domain)
+{
+  atomic_thread_fence(memory_order_seq_cst);
+
+  size_t global_epoch = atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire);
+
+  for (size_t record_index = 0; record_index < EPOCH_RECLAMATION_MAX_RECORDS; record_index++)
+  {
+    size_t announced_epoch = atomic_load_explicit(&epoch_domain->records[record_index].announced_epoch, memory_order_acquire);
+
+    if (announced_epoch != 0 && announced_epoch != 2 * global_epoch + 1)
+    {
+      return false;
+    }
+  }
+
+  /* A failed exchange means another thread has advanced the epoch in the meantime, which is just as good. */
+  atomic_compare_exchange_strong_explicit(&epoch_domain->global_epoch, &global_epoch, global_epoch + 1, memory_order_acq_rel, memory_order_acquire);
+
+  return true;
+}
+
+/**
+ * \brief Tries to advance the global epoch and releases every batch of a record that has become safe.
+ *
+ * A thread inside a critical section keeps the epoch from advancing more than once past the one it announced,
+ * so the pointers it retired during that critical section are only reclaimed by a later call made outside of it.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record whose retired pointers are to be reclaimed.
+ *
+ * \return The number of pointers of the record still awaiting reclamation.
+ */
+size_t reclaim_epoch_retired_pointers(EpochDomain *epoch_domain, EpochRecord *epoch_record)
+{
+  try_advance_epoch(epoch_domain);
+
+  size_t global_epoch = atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire);
+  size_t remaining_count = 0;
+
+  for (size_t batch_index = 0; batch_index < EPOCH_RECLAMATION_BATCH_COUNT; batch_index++)
+  {
+    EpochRetiredBatch *retired_batch = &epoch_record->retired_batches[batch_index];
+
+    if (retired_batch->retire_epoch + 2 <= global_epoch)
+    {
+      reclaim_epoch_retired_batch(epoch_domain, retired_batch);
+    }
+
+    remaining_count += retired_batch->retired_count;
+  }
+
+  epoch_record->pending_retired_count = 0;
+
+  return remaining_count;
+}
+
+/**
+ * \brief Makes room for one more pointer in a batch, doubling its array if it is full.
+ *
+ * \param retired_batch A pointer to the batch to be grown.
+ *
+ * \return true if the batch has room for one more pointer, false if its array could not be grown.
+ */
+static bool grow_epoch_retired_batch(EpochRetiredBatch *retired_batch)
+{
+  if (retired_batch->retired_count < retired_batch->retired_capacity)
+  {
+    return true;
+  }
+
+  size_t retired_capacity = retired_batch->retired_capacity == 0 ? EPOCH_RECLAMATION_RETIRE_THRESHOLD : 2 * retired_batch->retired_capacity;
+  void **retired_pointers = (void **)realloc(retired_batch->retired_pointers, retired_capacity * sizeof(void *));
+
+  if (retired_pointers == NULL)
+  {
+    return false;
+  }
+
+  retired_batch->retired_pointers = retired_pointers;
+  retired_batch->retired_capacity = retired_capacity;
+
+  return true;
+}
+
+/**
+ * \brief Waits until a pointer that could not be deferred is safe, then releases it at once.
+ *
+ * The global epoch is advanced until it is two past the epoch the pointer was retired in. A thread inside a
+ * critical section would keep it from getting there, so in that case the pointer cannot be released safely,
+ * and it is left unreleased and an error is reported.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record of the calling thread.
+ * \param pointer The pointer to be released.
+ * \param retire_epoch The global epoch the pointer was retired in.
+ */
+static void reclaim_epoch_pointer_after_grace_period(EpochDomain *epoch_domain, EpochRecord *epoch_record, void *pointer, size_t retire_epoch)
+{
+  if (epoch_record->critical_section_depth > 0)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'retired_pointers' inside a critical section, so the pointer cannot be reclaimed.");
+
+    return;
+  }
+
+  while (atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire) < retire_epoch + 2)
+  {
+    if (!try_advance_epoch(epoch_domain))
+    {
+      sched_yield();
+    }
+  }
+
+  epoch_domain->reclaim_function(pointer);
+}
+
+/**
+ * \brief Retires a pointer that is no longer reachable from the shared structure.
+ *
+ * The pointer is released with the `reclaim_function` of the domain once every thread that could still
+ * hold it has left its critical section. Every `EPOCH_RECLAMATION_RETIRE_THRESHOLD` retirements the record
+ * tries to advance the global epoch and releases every batch that has become safe at once. If the batch of
+ * the current epoch cannot grow, even after the batches that have become safe are released, the function
+ * waits for the grace period of the pointer and releases it itself, which requires the calling thread to be
+ * outside of any critical section.
+ *
+ * \param epoch_domain A pointer to the `EpochDomain` the record belongs to.
+ * \param epoch_record A pointer to the record of the calling thread.
+ * \param pointer The pointer to be retired.
+ */
+void retire_epoch_pointer(EpochDomain *epoch_domain, EpochRecord *epoch_record, void *pointer)
+{
+  /* The pointer was unlinked before this point, so it is tagged with an epoch no older than the unlinking. */
+  atomic_thread_fence(memory_order_seq_cst);
+
+  size_t global_epoch = atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire);
+  EpochRetiredBatch *retired_batch = &epoch_record->retired_batches[global_epoch % EPOCH_RECLAMATION_BATCH_COUNT];
+
+  if (retired_batch->retire_epoch != global_epoch)
+  {
+    /* The batch was filled at least EPOCH_RECLAMATION_BATCH_COUNT epochs ago, so all of its pointers are safe. */
+    reclaim_epoch_retired_batch(epoch_domain, retired_batch);
+
+    retired_batch->retire_epoch = global_epoch;
+  }
+
+  if (!grow_epoch_retired_batch(retired_batch))
+  {
+    /* Releasing the batches that have become safe gives memory back, and may even empty this batch. */
+    reclaim_epoch_retired_pointers(epoch_domain, epoch_record);
+
+    if (!grow_epoch_retired_batch(retired_batch))
+    {
+      reclaim_epoch_pointer_after_grace_period(epoch_domain, epoch_record, pointer, global_epoch);
+
+      return;
+    }
+  }
+
+  retired_batch->retired_pointers[retired_batch->retired_count++] = pointer;
+
+  if (++epoch_record->pending_retired_count >= EPOCH_RECLAMATION_RETIRE_THRESHOLD)
+  {
+    reclaim_epoch_retired_pointers(epoch_domain, epoch_record);
+  }
+}
@@ -0,0 +1,304 @@
+#include <stdlib.h>
+
+#include "../include/fine_grained_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Creates a new fine-grained singly linked list.
+ *
+ * This function allocates memory for a new `FineGrainedSinglyLinkedList` and initializes the mutex of its
+ * sentinel. If a function pointer is NULL or an allocation fails, an error message is printed and the
+ * function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param order_data_function A function pointer used to order the data of the nodes.
+ *
+ * \return A pointer to the newly created `FineGrainedSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+FineGrainedSinglyLinkedList *create_fine_grained_singly_linked_list(FreeDataFunction free_data_function, OrderDataFunction order_data_function)
+{
+  if (free_data_function == NULL || order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' and 'order_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  FineGrainedSinglyLinkedList *fine_grained_singly_linked_list = (FineGrainedSinglyLinkedList *)malloc(sizeof(FineGrainedSinglyLinkedList));
+
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'fine_grained_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  if (pthread_mutex_init(&fine_grained_singly_linked_list->head_sentinel.node_mutex, NULL) != 0)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Initialization failed for the mutex of 'head_sentinel'.");
+
+    free(fine_grained_singly_linked_list);
+
+    return NULL;
+  }
+
+  fine_grained_singly_linked_list->head_sentinel.node_data = NULL;
+  fine_grained_singly_linked_list->head_sentinel.next_node = NULL;
+
+  atomic_init(&fine_grained_singly_linked_list->length, 0);
+
+  fine_grained_singly_linked_list->free_data_function = free_data_function;
+  fine_grained_singly_linked_list->order_data_function = order_data_function;
+
+  return fine_grained_singly_linked_list;
+}
+
+/**
+ * \brief Walks the list hand over hand and returns the predecessor of the position of the provided data, still locked.
+ *
+ * Starting from the sentinel, this function locks each next node before unlocking the current one, and stops
+ * before the first node that goes after `node_data`, or that is equivalent to it when `skips_equivalent_nodes`
+ * is false. Since the returned node stays locked, its `next_node` cannot change until the caller unlocks it,
+ * and no other thread can unlink the node after it.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list to be walked.
+ * \param node_data The data whose position is searched for.
+ * \param skips_equivalent_nodes Whether the walk goes past the nodes equivalent to `node_data`.
+ *
+ * \return A pointer to the locked predecessor, which is the sentinel if the position is at the head.
+ */
+static FineGrainedNode *lock_predecessor_in_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data, bool skips_equivalent_nodes)
+{
+  FineGrainedNode *predecessor_node = &fine_grained_singly_linked_list->head_sentinel;
+
+  pthread_mutex_lock(&predecessor_node->node_mutex);
+
+  FineGrainedNode *current_node = predecessor_node->next_node;
+
+  while (current_node != NULL)
+  {
+    pthread_mutex_lock(&current_node->node_mutex);
+
+    int order = fine_grained_singly_linked_list->order_data_function(current_node->node_data, node_data);
+
+    if (order > 0 || (order == 0 && !skips_equivalent_nodes))
+    {
+      pthread_mutex_unlock(&current_node->node_mutex);
+
+      break;
+    }
+
+    pthread_mutex_unlock(&predecessor_node->node_mutex);
+
+    predecessor_node = current_node;
+    current_node = current_node->next_node;
+  }
+
+  return predecessor_node;
+}
+
+/**
+ * \brief Inserts a new node into the fine-grained singly linked list, keeping it sorted.
+ *
+ * This function links the new node after every node whose data goes before or is equivalent to `node_data`
+ * according to the `order_data_function` of the list, so insertions are stable. Only the predecessor of the
+ * new node stays locked while it is linked.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_into_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data)
+{
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL fine-grained singly linked list.");
+
+    return false;
+  }
+
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert NULL data in a fine-grained singly linked list.");
+
+    return false;
+  }
+
+  FineGrainedNode *new_node = (FineGrainedNode *)malloc(sizeof(FineGrainedNode));
+
+  if (new_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'new_node'.");
+
+    return false;
+  }
+
+  if (pthread_mutex_init(&new_node->node_mutex, NULL) != 0)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Initialization failed for the mutex of 'new_node'.");
+
+    free(new_node);
+
+    return false;
+  }
+
+  new_node->node_data = node_data;
+
+  FineGrainedNode *predecessor_node = lock_predecessor_in_fine_grained_list(fine_grained_singly_linked_list, node_data, true);
+
+  new_node->next_node = predecessor_node->next_node;
+  predecessor_node->next_node = new_node;
+
+  atomic_fetch_add_explicit(&fine_grained_singly_linked_list->length, 1, memory_order_relaxed);
+
+  pthread_mutex_unlock(&predecessor_node->node_mutex);
+
+  return true;
+}
+
+/**
+ * \brief Searches the fine-grained singly linked list for the first node whose data is equivalent to the provided data.
+ *
+ * Nodes are matched with the `order_data_function` of the list, and the search stops at the first node that
+ * goes after `node_data`. The returned data is still owned by the list, so a caller that lets other threads
+ * delete the matching node concurrently must coordinate the lifetime of the data itself.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list to search in.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The data of the first matching node, or `NULL` if no node matches or an error occurs.
+ */
+NodeData find_node_data_in_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data)
+{
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for a node in a NULL fine-grained singly linked list.");
+
+    return NULL;
+  }
+
+  FineGrainedNode *predecessor_node = lock_predecessor_in_fine_grained_list(fine_grained_singly_linked_list, node_data, false);
+  FineGrainedNode *candidate_node = predecessor_node->next_node;
+  NodeData found_node_data = NULL;
+
+  /* The candidate cannot be unlinked while its predecessor is locked, so its data can be read without its own lock. */
+  if (candidate_node != NULL && fine_grained_singly_linked_list->order_data_function(candidate_node->node_data, node_data) == 0)
+  {
+    found_node_data = candidate_node->node_data;
+  }
+
+  pthread_mutex_unlock(&predecessor_node->node_mutex);
+
+  return found_node_data;
+}
+
+/**
+ * \brief Deletes every node of the fine-grained singly linked list whose data is equivalent to the provided data.
+ *
+ * The matching nodes are found like in `find_node_data_in_fine_grained_list`. Each of them is locked before it
+ * is unlinked, so that no thread still holds it when its data and the node itself are freed.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list from which nodes will be deleted.
+ * \param node_data The data to search for in the list.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_node_from_fine_grained_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list, NodeData node_data)
+{
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node from a NULL fine-grained singly linked list.");
+
+    return 0;
+  }
+
+  FineGrainedNode *predecessor_node = lock_predecessor_in_fine_grained_list(fine_grained_singly_linked_list, node_data, false);
+  FineGrainedNode *current_node = predecessor_node->next_node;
+  size_t deleted_nodes_count = 0;
+
+  while (current_node != NULL && fine_grained_singly_linked_list->order_data_function(current_node->node_data, node_data) == 0)
+  {
+    /* A thread that reached the node before the predecessor was locked may still hold it, so wait for it to move on. */
+    pthread_mutex_lock(&current_node->node_mutex);
+
+    FineGrainedNode *next_node = current_node->next_node;
+
+    predecessor_node->next_node = next_node;
+
+    pthread_mutex_unlock(&current_node->node_mutex);
+    pthread_mutex_destroy(&current_node->node_mutex);
+
+    fine_grained_singly_linked_list->free_data_function(current_node->node_data);
+
+    free(current_node);
+
+    current_node = next_node;
+    deleted_nodes_count++;
+  }
+
+  atomic_fetch_sub_explicit(&fine_grained_singly_linked_list->length, deleted_nodes_count, memory_order_relaxed);
+
+  pthread_mutex_unlock(&predecessor_node->node_mutex);
+
+  return deleted_nodes_count;
+}
+
+/**
+ * \brief Returns the number of nodes in the fine-grained singly linked list.
+ *
+ * The value is exact when no other thread is modifying the list, and a recent snapshot otherwise.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_fine_grained_singly_linked_list_length(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list)
+{
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    return 0;
+  }
+
+  return atomic_load_explicit(&fine_grained_singly_linked_list->length, memory_order_relaxed);
+}
+
+/**
+ * \brief Frees all the nodes of the fine-grained singly linked list.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty and the mutex of its sentinel
+ * is destroyed, so it can only be released with `free`.
+ *
+ * \param fine_grained_singly_linked_list A pointer to the list to be freed.
+ */
+void free_fine_grained_singly_linked_list(FineGrainedSinglyLinkedList *fine_grained_singly_linked_list)
+{
+  if (fine_grained_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL fine-grained singly linked list.");
+
+    return;
+  }
+
+  FineGrainedNode *current_node = fine_grained_singly_linked_list->head_sentinel.next_node;
+  FineGrainedNode *next_node = NULL;
+
+  while (current_node != NULL)
+  {
+    next_node = current_node->next_node;
+
+    pthread_mutex_destroy(&current_node->node_mutex);
+
+    fine_grained_singly_linked_list->free_data_function(current_node->node_data);
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  fine_grained_singly_linked_list->head_sentinel.next_node = NULL;
+
+  pthread_mutex_destroy(&fine_grained_singly_linked_list->head_sentinel.node_mutex);
+
+  atomic_store_explicit(&fine_grained_singly_linked_list->length, 0, memory_order_relaxed);
+}
@@ -0,0 +1,267 @@
+#include <stdlib.h>
+
+#include "../include/hash_index.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Creates a new empty hash index.
+ *
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ * \param compare_data_function A function pointer used to compare node data. This cannot be `NULL`.
+ *
+ * \return A pointer to the newly created `HashIndex` if successful, or `NULL` if an error occurs.
+ */
+HashIndex *create_hash_index(HashDataFunction hash_data_function, CompareDataFunction compare_data_function)
+{
+  if (hash_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'hash_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  HashIndex *hash_index = (HashIndex *)malloc(sizeof(HashIndex));
+
+  if (hash_index == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'hash_index'.");
+
+    return NULL;
+  }
+
+  hash_index->entries = (HashIndexEntry *)calloc(HASH_INDEX_INITIAL_CAPACITY, sizeof(HashIndexEntry));
+
+  if (hash_index->entries == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'entries'.");
+
+    free(hash_index);
+
+    return NULL;
+  }
+
+  hash_index->capacity = HASH_INDEX_INITIAL_CAPACITY;
+  hash_index->count = 0;
+  hash_index->hash_data_function = hash_data_function;
+  hash_index->compare_data_function = compare_data_function;
+
+  return hash_index;
+}
+
+/**
+ * \brief Places an entry in the first empty slot of its probe sequence.
+ *
+ * \param entries The slots of the table.
+ * \param capacity The number of slots, a power of two.
+ * \param entry The entry to be placed.
+ */
+static void place_hash_index_entry(HashIndexEntry *entries, size_t capacity, HashIndexEntry entry)
+{
+  size_t slot_index = entry.node_hash & (capacity - 1);
+
+  while (entries[slot_index].node != NULL)
+  {
+    slot_index = (slot_index + 1) & (capacity - 1);
+  }
+
+  entries[slot_index] = entry;
+}
+
+/**
+ * \brief Moves every entry of the hash index into a new table of twice the capacity.
+ *
+ * \param hash_index A pointer to the `HashIndex` to be grown.
+ *
+ * \return true if the table was grown, false if the allocation failed.
+ */
+static bool grow_hash_index(HashIndex *hash_index)
+{
+  size_t new_capacity = hash_index->capacity * 2;
+  HashIndexEntry *new_entries = (HashIndexEntry *)calloc(new_capacity, sizeof(HashIndexEntry));
+
+  if (new_entries == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'entries'.");
+
+    return false;
+  }
+
+  for (size_t slot_index = 0; slot_index < hash_index->capacity; slot_index++)
+  {
+    if (hash_index->entries[slot_index].node != NULL)
+    {
+      place_hash_index_entry(new_entries, new_capacity, hash_index->entries[slot_index]);
+    }
+  }
+
+  free(hash_index->entries);
+
+  hash_index->entries = new_entries;
+  hash_index->capacity = new_capacity;
+
+  return true;
+}
+
+/**
+ * \brief Adds a node to the hash index, growing the table if needed.
+ *
+ * \param hash_index A pointer to the `HashIndex` where the node will be added.
+ * \param node A pointer to the node to be indexed.
+ *
+ * \return true if the node was added, false if the table could not be grown.
+ */
+bool insert_node_into_hash_index(HashIndex *hash_index, Node *node)
+{
+  if ((hash_index->count + 1) * 2 > hash_index->capacity && !grow_hash_index(hash_index))
+  {
+    return false;
+  }
+
+  HashIndexEntry entry = {node, hash_index->hash_data_function(node->node_data)};
+
+  place_hash_index_entry(hash_index->entries, hash_index->capacity, entry);
+
+  hash_index->count++;
+
+  return true;
+}
+
+/**
+ * \brief Removes a node from the hash index.
+ *
+ * The data of the node must still be valid, since it is hashed to locate the slot of the node.
+ *
+ * \param hash_index A pointer to the `HashIndex` from which the node will be removed.
+ * \param node A pointer to the node to be removed.
+ *
+ * \return true if the node was found and removed, false otherwise.
+ */
+bool remove_node_from_hash_index(HashIndex *hash_index, Node *node)
+{
+  size_t mask = hash_index->capacity - 1;
+  size_t slot_index = hash_index->hash_data_function(node->node_data) & mask;
+
+  while (hash_index->entries[slot_index].node != node)
+  {
+    if (hash_index->entries[slot_index].node == NULL)
+    {
+      return false;
+    }
+
+    slot_index = (slot_index + 1) & mask;
+  }
+
+  size_t empty_index = slot_index;
+
+  while (true)
+  {
+    slot_index = (slot_index + 1) & mask;
+
+    if (hash_index->entries[slot_index].node == NULL)
+    {
+      break;
+    }
+
+    size_t home_index = hash_index->entries[slot_index].node_hash & mask;
+    bool is_home_between = empty_index <= slot_index
+                               ? (empty_index < home_index && home_index <= slot_index)
+                               : (empty_index < home_index || home_index <= slot_index);
+
+    if (!is_home_between)
+    {
+      hash_index->entries[empty_index] = hash_index->entries[slot_index];
+      empty_index = slot_index;
+    }
+  }
+
+  hash_index->entries[empty_index].node = NULL;
+  hash_index->count--;
+
+  return true;
+}
+
+/**
+ * \brief Searches the hash index for a node whose data matches the provided data.
+ *
+ * \param hash_index A pointer to the `HashIndex` to search in.
+ * \param node_data The data to search for.
+ *
+ * \return A pointer to one of the nodes with matching data, or `NULL` if there is none.
+ */
+Node *find_node_in_hash_index(HashIndex *hash_index, NodeData node_data)
+{
+  size_t mask = hash_index->capacity - 1;
+  size_t node_hash = hash_index->hash_data_function(node_data);
+
+  for (size_t slot_index = node_hash & mask; hash_index->entries[slot_index].node != NULL; slot_index = (slot_index + 1) & mask)
+  {
+    HashIndexEntry *entry = &hash_index->entries[slot_index];
+
+    if (entry->node_hash == node_hash && hash_index->compare_data_function(entry->node->node_data, node_data))
+    {
+      return entry->node;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Counts the indexed nodes whose data matches the provided data.
+ *
+ * \param hash_index A pointer to the `HashIndex` to search in.
+ * \param node_data The data to search for.
+ *
+ * \return The number of nodes with matching data.
+ */
+size_t count_nodes_in_hash_index(HashIndex *hash_index, NodeData node_data)
+{
+  size_t mask = hash_index->capacity - 1;
+  size_t node_hash = hash_index->hash_data_function(node_data);
+  size_t matching_nodes_count = 0;
+
+  for (size_t slot_index = node_hash & mask; hash_index->entries[slot_index].node != NULL; slot_index = (slot_index + 1) & mask)
+  {
+    HashIndexEntry *entry = &hash_index->entries[slot_index];
+
+    if (entry->node_hash == node_hash && hash_index->compare_data_function(entry->node->node_data, node_data))
+    {
+      matching_nodes_count++;
+    }
+  }
+
+  return matching_nodes_count;
+}
+
+/**
+ * \brief Removes every node from the hash index without shrinking it.
+ *
+ * \param hash_index A pointer to the `HashIndex` to be cleared.
+ */
+void clear_hash_index(HashIndex *hash_index)
+{
+  for (size_t slot_index = 0; slot_index < hash_index->capacity; slot_index++)
+  {
+    hash_index->entries[slot_index].node = NULL;
+  }
+
+  hash_index->count = 0;
+}
+
+/**
+ * \brief Frees the hash index and its table. The indexed nodes are not touched.
+ *
+ * \param hash_index A pointer to the `HashIndex` to be freed.
+ */
+void free_hash_index(HashIndex *hash_index)
+{
+  free(hash_index->entries);
+  free(hash_index);
+}
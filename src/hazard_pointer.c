@@ -0,0 +1,246 @@
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../include/hazard_pointer.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Initializes a hazard pointer domain.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to be initialized.
+ * \param reclaim_function A function pointer used to release retired pointers. This cannot be `NULL`.
+ */
+void initialize_hazard_pointer_domain(HazardPointerDomain *hazard_pointer_domain, ReclaimFunction reclaim_function)
+{
+  for (size_t record_index = 0; record_index < HAZARD_POINTER_MAX_RECORDS; record_index++)
+  {
+    HazardPointerRecord *hazard_pointer_record = &hazard_pointer_domain->records[record_index];
+
+    for (size_t hazard_pointer_index = 0; hazard_pointer_index < HAZARD_POINTERS_PER_RECORD; hazard_pointer_index++)
+    {
+      atomic_init(&hazard_pointer_record->hazard_pointers[hazard_pointer_index], NULL);
+    }
+
+    atomic_init(&hazard_pointer_record->is_active, false);
+
+    hazard_pointer_record->retired_pointers = NULL;
+    hazard_pointer_record->retired_count = 0;
+  }
+
+  hazard_pointer_domain->reclaim_function = reclaim_function;
+}
+
+/**
+ * \brief Releases every pointer still retired in the domain and the memory used by its records.
+ *
+ * No thread may be using the domain while it is destroyed.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to be destroyed.
+ */
+void destroy_hazard_pointer_domain(HazardPointerDomain *hazard_pointer_domain)
+{
+  for (size_t record_index = 0; record_index < HAZARD_POINTER_MAX_RECORDS; record_index++)
+  {
+    HazardPointerRecord *hazard_pointer_record = &hazard_pointer_domain->records[record_index];
+
+    for (size_t retired_index = 0; retired_index < hazard_pointer_record->retired_count; retired_index++)
+    {
+      hazard_pointer_domain->reclaim_function(hazard_pointer_record->retired_pointers[retired_index]);
+    }
+
+    free(hazard_pointer_record->retired_pointers);
+
+    hazard_pointer_record->retired_pointers = NULL;
+    hazard_pointer_record->retired_count = 0;
+  }
+}
+
+/**
+ * \brief Acquires an unused record of the domain for the calling thread.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` to acquire the record from.
+ *
+ * \return A pointer to the acquired record, or `NULL` if all `HAZARD_POINTER_MAX_RECORDS` records are in use.
+ */
+HazardPointerRecord *acquire_hazard_pointer_record(HazardPointerDomain *hazard_pointer_domain)
+{
+  for (size_t record_index = 0; record_index < HAZARD_POINTER_MAX_RECORDS; record_index++)
+  {
+    HazardPointerRecord *hazard_pointer_record = &hazard_pointer_domain->records[record_index];
+    bool is_active = false;
+
+    if (atomic_compare_exchange_strong_explicit(&hazard_pointer_record->is_active, &is_active, true, memory_order_acquire, memory_order_relaxed))
+    {
+      return hazard_pointer_record;
+    }
+  }
+
+  REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED, "All hazard pointer records are in use.");
+
+  return NULL;
+}
+
+/**
+ * \brief Clears the hazard pointers of a record and gives it back to the domain.
+ *
+ * The pointers retired through the record stay in it and are reclaimed by its next owner or when the
+ * domain is destroyed.
+ *
+ * \param hazard_pointer_record A pointer to the record to be released.
+ */
+void release_hazard_pointer_record(HazardPointerRecord *hazard_pointer_record)
+{
+  for (size_t hazard_pointer_index = 0; hazard_pointer_index < HAZARD_POINTERS_PER_RECORD; hazard_pointer_index++)
+  {
+    atomic_store_explicit(&hazard_pointer_record->hazard_pointers[hazard_pointer_index], NULL, memory_order_release);
+  }
+
+  atomic_store_explicit(&hazard_pointer_record->is_active, false, memory_order_release);
+}
+
+/**
+ * \brief Publishes a pointer that the owning thread is about to access.
+ *
+ * The caller must check that the pointer is still reachable after publishing it, since it may have been
+ * retired in between.
+ *
+ * \param hazard_pointer_record A pointer to the record of the calling thread.
+ * \param hazard_pointer_index The index of the hazard pointer to set, below `HAZARD_POINTERS_PER_RECORD`.
+ * \param pointer The pointer to protect, or `NULL` to clear the hazard pointer.
+ */
+void set_hazard_pointer(HazardPointerRecord *hazard_pointer_record, size_t hazard_pointer_index, void *pointer)
+{
+  atomic_store_explicit(&hazard_pointer_record->hazard_pointers[hazard_pointer_index], pointer, memory_order_seq_cst);
+}
+
+/**
+ * \brief Orders two pointers by address, for use with `qsort` and `bsearch`.
+ */
+static int compare_pointers(const void *first_pointer, const void *second_pointer)
+{
+  uintptr_t first_address = (uintptr_t)*(void *const *)first_pointer;
+  uintptr_t second_address = (uintptr_t)*(void *const *)second_pointer;
+
+  return (first_address > second_address) - (first_address < second_address);
+}
+
+/**
+ * \brief Releases every pointer retired through a record that no record of the domain protects.
+ *
+ * This function takes a snapshot of all the hazard pointers of the domain, sorts it, and releases every
+ * retired pointer that is not found in it. The pointers still protected are kept for the next scan.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` the record belongs to.
+ * \param hazard_pointer_record A pointer to the record whose retired pointers are scanned.
+ */
+static void scan_hazard_pointers(HazardPointerDomain *hazard_pointer_domain, HazardPointerRecord *hazard_pointer_record)
+{
+  void *protected_pointers[HAZARD_POINTER_MAX_RECORDS * HAZARD_POINTERS_PER_RECORD];
+  size_t protected_count = 0;
+
+  for (size_t record_index = 0; record_index < HAZARD_POINTER_MAX_RECORDS; record_index++)
+  {
+    HazardPointerRecord *current_record = &hazard_pointer_domain->records[record_index];
+
+    for (size_t hazard_pointer_index = 0; hazard_pointer_index < HAZARD_POINTERS_PER_RECORD; hazard_pointer_index++)
+    {
+      void *pointer = atomic_load_explicit(&current_record->hazard_pointers[hazard_pointer_index], memory_order_seq_cst);
+
+      if (pointer != NULL)
+      {
+        protected_pointers[protected_count++] = pointer;
+      }
+    }
+  }
+
+  qsort(protected_pointers, protected_count, sizeof(void *), compare_pointers);
+
+  size_t kept_count = 0;
+
+  for (size_t retired_index = 0; retired_index < hazard_pointer_record->retired_count; retired_index++)
+  {
+    void *pointer = hazard_pointer_record->retired_pointers[retired_index];
+
+    if (bsearch(&pointer, protected_pointers, protected_count, sizeof(void *), compare_pointers) != NULL)
+    {
+      hazard_pointer_record->retired_pointers[kept_count++] = pointer;
+    }
+    else
+    {
+      hazard_pointer_domain->reclaim_function(pointer);
+    }
+  }
+
+  hazard_pointer_record->retired_count = kept_count;
+}
+
+/**
+ * \brief Waits until no record of the domain protects a pointer that could not be deferred, then releases it.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` the pointer was retired in.
+ * \param pointer The pointer to be released.
+ */
+static void reclaim_hazard_pointer_when_unprotected(HazardPointerDomain *hazard_pointer_domain, void *pointer)
+{
+  size_t record_index = 0;
+
+  while (record_index < HAZARD_POINTER_MAX_RECORDS)
+  {
+    HazardPointerRecord *current_record = &hazard_pointer_domain->records[record_index];
+    bool is_protected = false;
+
+    for (size_t hazard_pointer_index = 0; hazard_pointer_index < HAZARD_POINTERS_PER_RECORD; hazard_pointer_index++)
+    {
+      if (atomic_load_explicit(&current_record->hazard_pointers[hazard_pointer_index], memory_order_seq_cst) == pointer)
+      {
+        is_protected = true;
+      }
+    }
+
+    if (is_protected)
+    {
+      sched_yield();
+    }
+    else
+    {
+      record_index++;
+    }
+  }
+
+  hazard_pointer_domain->reclaim_function(pointer);
+}
+
+/**
+ * \brief Retires a pointer that is no longer reachable from the shared structure.
+ *
+ * The pointer is released with the `reclaim_function` of the domain once no record holds it as a hazard
+ * pointer. Every `HAZARD_POINTER_RETIRE_THRESHOLD` retirements the record scans the domain and releases
+ * every pointer that is no longer protected. If the array of retired pointers of the record cannot be
+ * allocated, the function waits until no record protects the pointer and releases it itself.
+ *
+ * \param hazard_pointer_domain A pointer to the `HazardPointerDomain` the record belongs to.
+ * \param hazard_pointer_record A pointer to the record of the calling thread.
+ * \param pointer The pointer to be retired.
+ */
+void retire_hazard_pointer(HazardPointerDomain *hazard_pointer_domain, HazardPointerRecord *hazard_pointer_record, void *pointer)
+{
+  if (hazard_pointer_record->retired_pointers == NULL)
+  {
+    hazard_pointer_record->retired_pointers = (void **)malloc(HAZARD_POINTER_RETIRE_THRESHOLD * sizeof(void *));
+
+    if (hazard_pointer_record->retired_pointers == NULL)
+    {
+      reclaim_hazard_pointer_when_unprotected(hazard_pointer_domain, pointer);
+
+      return;
+    }
+  }
+
+  hazard_pointer_record->retired_pointers[hazard_pointer_record->retired_count++] = pointer;
+
+  if (hazard_pointer_record->retired_count == HAZARD_POINTER_RETIRE_THRESHOLD)
+  {
+    scan_hazard_pointers(hazard_pointer_domain, hazard_pointer_record);
+  }
+}
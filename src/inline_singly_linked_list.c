@@ -0,0 +1,386 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/inline_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Creates a new inline singly linked list for payloads of the provided size.
+ *
+ * This function allocates memory for a new `InlineSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing payloads. If `element_size` is 0, the
+ * print or compare function pointer is NULL or the allocation fails, an error is reported and the function
+ * returns `NULL`.
+ *
+ * \param element_size The size in bytes of every payload stored in the list.
+ * \param print_data_function A function pointer used to print a payload.
+ * \param free_data_function A function pointer used to release the resources owned by a payload before its node is
+ * freed. It must not free the payload itself, and may be `NULL` for payloads that do not own any resources.
+ * \param compare_data_function A function pointer used to compare a payload with the key passed to find and delete.
+ *
+ * \return A pointer to the newly created `InlineSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+InlineSinglyLinkedList *create_inline_singly_linked_list(size_t element_size, PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
+{
+  if (element_size == 0 || element_size > SIZE_MAX - sizeof(InlineNode))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT, "'element_size' must be greater than 0 and fit in a node.");
+
+    return NULL;
+  }
+
+  if (print_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  InlineSinglyLinkedList *inline_singly_linked_list = (InlineSinglyLinkedList *)malloc(sizeof(InlineSinglyLinkedList));
+
+  if (inline_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'inline_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  inline_singly_linked_list->head_node = NULL;
+  inline_singly_linked_list->tail_node = NULL;
+  inline_singly_linked_list->length = 0;
+  inline_singly_linked_list->element_size = element_size;
+  inline_singly_linked_list->print_data_function = print_data_function;
+  inline_singly_linked_list->free_data_function = free_data_function;
+  inline_singly_linked_list->compare_data_function = compare_data_function;
+
+  return inline_singly_linked_list;
+}
+
+/**
+ * \brief Creates a new node holding a copy of a payload for an inline singly linked list.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` whose element size is used.
+ * \param element A pointer to the payload to be copied. This cannot be `NULL`.
+ *
+ * \return A pointer to the newly created `InlineNode` if successful, or `NULL` if an error occurs.
+ */
+static InlineNode *create_inline_node(InlineSinglyLinkedList *inline_singly_linked_list, const void *element)
+{
+  if (element == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert a NULL element.");
+
+    return NULL;
+  }
+
+  InlineNode *inline_node = (InlineNode *)malloc(sizeof(InlineNode) + inline_singly_linked_list->element_size);
+
+  if (inline_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'inline_node'.");
+
+    return NULL;
+  }
+
+  inline_node->next_node = NULL;
+
+  memcpy(inline_node->node_data, element, inline_singly_linked_list->element_size);
+
+  return inline_node;
+}
+
+/**
+ * \brief Releases the resources owned by the payload of a node and frees the node.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` the node belongs to.
+ * \param inline_node A pointer to the node to be freed.
+ */
+static void free_inline_node(InlineSinglyLinkedList *inline_singly_linked_list, InlineNode *inline_node)
+{
+  if (inline_singly_linked_list->free_data_function != NULL)
+  {
+    inline_singly_linked_list->free_data_function(inline_node->node_data);
+  }
+
+  free(inline_node);
+}
+
+/**
+ * \brief Inserts a copy of a payload at the head of the inline singly linked list.
+ *
+ * The node and the payload are allocated together and `element_size` bytes are copied from `element`.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` where the payload will be inserted.
+ * \param element A pointer to the payload to be copied. This cannot be `NULL`.
+ */
+void insert_element_at_inline_singly_linked_list_head(InlineSinglyLinkedList *inline_singly_linked_list, const void *element)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert an element on a NULL inline singly linked list.");
+
+    return;
+  }
+
+  InlineNode *new_node = create_inline_node(inline_singly_linked_list, element);
+
+  if (new_node == NULL)
+  {
+    return;
+  }
+
+  new_node->next_node = inline_singly_linked_list->head_node;
+  inline_singly_linked_list->head_node = new_node;
+
+  if (inline_singly_linked_list->tail_node == NULL)
+  {
+    inline_singly_linked_list->tail_node = new_node;
+  }
+
+  inline_singly_linked_list->length++;
+}
+
+/**
+ * \brief Inserts a copy of a payload at the tail of the inline singly linked list.
+ *
+ * The node and the payload are allocated together and `element_size` bytes are copied from `element`.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` where the payload will be inserted.
+ * \param element A pointer to the payload to be copied. This cannot be `NULL`.
+ */
+void insert_element_at_inline_singly_linked_list_tail(InlineSinglyLinkedList *inline_singly_linked_list, const void *element)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert an element on a NULL inline singly linked list.");
+
+    return;
+  }
+
+  InlineNode *new_node = create_inline_node(inline_singly_linked_list, element);
+
+  if (new_node == NULL)
+  {
+    return;
+  }
+
+  if (inline_singly_linked_list->tail_node == NULL)
+  {
+    inline_singly_linked_list->head_node = new_node;
+  }
+  else
+  {
+    inline_singly_linked_list->tail_node->next_node = new_node;
+  }
+
+  inline_singly_linked_list->tail_node = new_node;
+  inline_singly_linked_list->length++;
+}
+
+/**
+ * \brief Prints all the payloads in the inline singly linked list, from head to tail.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be printed.
+ */
+void print_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL inline singly linked list.");
+
+    return;
+  }
+
+  for (InlineNode *current_node = inline_singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    inline_singly_linked_list->print_data_function(current_node->node_data);
+  }
+}
+
+/**
+ * \brief Frees all the nodes in the inline singly linked list and leaves it empty.
+ *
+ * The `free_data_function` of the list, if any, is called on every payload before its node is freed.
+ * The list structure itself is not freed.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be freed.
+ */
+void free_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL inline singly linked list.");
+
+    return;
+  }
+
+  InlineNode *current_node = inline_singly_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    InlineNode *next_node = current_node->next_node;
+
+    free_inline_node(inline_singly_linked_list, current_node);
+
+    current_node = next_node;
+  }
+
+  inline_singly_linked_list->head_node = NULL;
+  inline_singly_linked_list->tail_node = NULL;
+  inline_singly_linked_list->length = 0;
+}
+
+/**
+ * \brief Returns the number of nodes in the inline singly linked list in constant time.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_inline_singly_linked_list_length(InlineSinglyLinkedList *inline_singly_linked_list)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    return 0;
+  }
+
+  return inline_singly_linked_list->length;
+}
+
+/**
+ * \brief Reverses the order of the nodes in the inline singly linked list.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be reversed.
+ */
+void reverse_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL inline singly linked list.");
+
+    return;
+  }
+
+  InlineNode *previous_node = NULL;
+  InlineNode *current_node = inline_singly_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    InlineNode *next_node = current_node->next_node;
+
+    current_node->next_node = previous_node;
+    previous_node = current_node;
+    current_node = next_node;
+  }
+
+  inline_singly_linked_list->tail_node = inline_singly_linked_list->head_node;
+  inline_singly_linked_list->head_node = previous_node;
+}
+
+/**
+ * \brief Searches for the first node of the inline singly linked list whose payload matches the provided key.
+ *
+ * The compare function of the list is called with a pointer to the payload inside every node and the key,
+ * so no pointer to the payload has to be loaded.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to search in.
+ * \param key The key to search for.
+ *
+ * \return A pointer to the matching node, or `NULL` if no node is found.
+ */
+InlineNode *find_node_in_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list, NodeData key)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for a node in a NULL inline singly linked list.");
+
+    return NULL;
+  }
+
+  for (InlineNode *current_node = inline_singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    if (inline_singly_linked_list->compare_data_function(current_node->node_data, key))
+    {
+      return current_node;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Checks if an inline singly linked list is valid.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` to be checked.
+ *
+ * \return true if the inline singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list)
+{
+  return inline_singly_linked_list != NULL;
+}
+
+/**
+ * \brief Deletes every node of the inline singly linked list whose payload matches the provided key.
+ *
+ * \param inline_singly_linked_list A pointer to the `InlineSinglyLinkedList` from which nodes will be deleted.
+ * \param key The key to search for. Nodes whose payload matches it will be deleted.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_elements_from_inline_singly_linked_list(InlineSinglyLinkedList *inline_singly_linked_list, NodeData key)
+{
+  if (!is_valid_inline_singly_linked_list(inline_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node on a NULL inline singly linked list.");
+
+    return 0;
+  }
+
+  size_t deleted_nodes_count = 0;
+  InlineNode *previous_node = NULL;
+  InlineNode *current_node = inline_singly_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    InlineNode *next_node = current_node->next_node;
+
+    if (inline_singly_linked_list->compare_data_function(current_node->node_data, key))
+    {
+      if (previous_node == NULL)
+      {
+        inline_singly_linked_list->head_node = next_node;
+      }
+      else
+      {
+        previous_node->next_node = next_node;
+      }
+
+      if (next_node == NULL)
+      {
+        inline_singly_linked_list->tail_node = previous_node;
+      }
+
+      free_inline_node(inline_singly_linked_list, current_node);
+
+      inline_singly_linked_list->length--;
+      deleted_nodes_count++;
+    }
+    else
+    {
+      previous_node = current_node;
+    }
+
+    current_node = next_node;
+  }
+
+  return deleted_nodes_count;
+}
@@ -0,0 +1,431 @@
+#include <stdlib.h>
+
+#include "../include/intrusive_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Creates a new intrusive singly linked list with the provided link offset and function pointers.
+ *
+ * This function allocates memory for a new `IntrusiveSinglyLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing elements. If any of the function
+ * pointers is NULL or the allocation fails, an error is reported and the function returns `NULL`.
+ *
+ * \param link_offset The offset of the `IntrusiveLink` inside the elements, usually `offsetof(type, member)`.
+ * \param print_data_function A function pointer used to print an element.
+ * \param free_data_function A function pointer used to free an element.
+ * \param compare_data_function A function pointer used to compare an element with the key passed to find and delete.
+ *
+ * \return A pointer to the newly created `IntrusiveSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+IntrusiveSinglyLinkedList *create_intrusive_singly_linked_list(size_t link_offset, PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
+{
+  if (print_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (free_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  IntrusiveSinglyLinkedList *intrusive_singly_linked_list = (IntrusiveSinglyLinkedList *)malloc(sizeof(IntrusiveSinglyLinkedList));
+
+  if (intrusive_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'intrusive_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  intrusive_singly_linked_list->head_link = NULL;
+  intrusive_singly_linked_list->tail_link = NULL;
+  intrusive_singly_linked_list->length = 0;
+  intrusive_singly_linked_list->link_offset = link_offset;
+  intrusive_singly_linked_list->print_data_function = print_data_function;
+  intrusive_singly_linked_list->free_data_function = free_data_function;
+  intrusive_singly_linked_list->compare_data_function = compare_data_function;
+
+  return intrusive_singly_linked_list;
+}
+
+/**
+ * \brief Returns the link embedded in an element of the intrusive singly linked list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` whose link offset is used.
+ * \param element A pointer to the element.
+ *
+ * \return A pointer to the link of the element.
+ */
+static inline IntrusiveLink *get_link_of_element(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element)
+{
+  return (IntrusiveLink *)((char *)element + intrusive_singly_linked_list->link_offset);
+}
+
+/**
+ * \brief Returns the element of the intrusive singly linked list that embeds a link.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` whose link offset is used.
+ * \param link A pointer to the link.
+ *
+ * \return A pointer to the element embedding the link.
+ */
+static inline NodeData get_element_of_link(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, IntrusiveLink *link)
+{
+  return (NodeData)((char *)link - intrusive_singly_linked_list->link_offset);
+}
+
+/**
+ * \brief Inserts an element at the head of the intrusive singly linked list.
+ *
+ * The element is linked through its embedded link, so nothing is allocated. The link must not be in use by
+ * any other list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` where the element will be inserted.
+ * \param element The element to be inserted. This cannot be `NULL`.
+ */
+void insert_element_at_intrusive_singly_linked_list_head(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert an element on a NULL intrusive singly linked list.");
+
+    return;
+  }
+
+  if (element == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert a NULL element.");
+
+    return;
+  }
+
+  IntrusiveLink *new_link = get_link_of_element(intrusive_singly_linked_list, element);
+
+  new_link->next_link = intrusive_singly_linked_list->head_link;
+  intrusive_singly_linked_list->head_link = new_link;
+
+  if (intrusive_singly_linked_list->tail_link == NULL)
+  {
+    intrusive_singly_linked_list->tail_link = new_link;
+  }
+
+  intrusive_singly_linked_list->length++;
+}
+
+/**
+ * \brief Inserts an element at the tail of the intrusive singly linked list.
+ *
+ * The element is linked through its embedded link, so nothing is allocated. The link must not be in use by
+ * any other list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` where the element will be inserted.
+ * \param element The element to be inserted. This cannot be `NULL`.
+ */
+void insert_element_at_intrusive_singly_linked_list_tail(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert an element on a NULL intrusive singly linked list.");
+
+    return;
+  }
+
+  if (element == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert a NULL element.");
+
+    return;
+  }
+
+  IntrusiveLink *new_link = get_link_of_element(intrusive_singly_linked_list, element);
+
+  new_link->next_link = NULL;
+
+  if (intrusive_singly_linked_list->tail_link == NULL)
+  {
+    intrusive_singly_linked_list->head_link = new_link;
+  }
+  else
+  {
+    intrusive_singly_linked_list->tail_link->next_link = new_link;
+  }
+
+  intrusive_singly_linked_list->tail_link = new_link;
+  intrusive_singly_linked_list->length++;
+}
+
+/**
+ * \brief Prints all the elements in the intrusive singly linked list, from head to tail.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be printed.
+ */
+void print_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL intrusive singly linked list.");
+
+    return;
+  }
+
+  for (IntrusiveLink *current_link = intrusive_singly_linked_list->head_link; current_link != NULL; current_link = current_link->next_link)
+  {
+    intrusive_singly_linked_list->print_data_function(get_element_of_link(intrusive_singly_linked_list, current_link));
+  }
+}
+
+/**
+ * \brief Frees all the elements in the intrusive singly linked list and leaves it empty.
+ *
+ * Every element is passed to the `free_data_function` of the list, which releases the element together with
+ * its embedded link. The list structure itself is not freed.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be freed.
+ */
+void free_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL intrusive singly linked list.");
+
+    return;
+  }
+
+  IntrusiveLink *current_link = intrusive_singly_linked_list->head_link;
+
+  while (current_link != NULL)
+  {
+    IntrusiveLink *next_link = current_link->next_link;
+
+    intrusive_singly_linked_list->free_data_function(get_element_of_link(intrusive_singly_linked_list, current_link));
+
+    current_link = next_link;
+  }
+
+  intrusive_singly_linked_list->head_link = NULL;
+  intrusive_singly_linked_list->tail_link = NULL;
+  intrusive_singly_linked_list->length = 0;
+}
+
+/**
+ * \brief Returns the number of elements in the intrusive singly linked list in constant time.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` whose length is to be returned.
+ *
+ * \return The number of elements in the list, or 0 if the list is invalid.
+ */
+size_t get_intrusive_singly_linked_list_length(IntrusiveSinglyLinkedList *intrusive_singly_linked_list)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    return 0;
+  }
+
+  return intrusive_singly_linked_list->length;
+}
+
+/**
+ * \brief Reverses the order of the elements in the intrusive singly linked list by relinking their links.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be reversed.
+ */
+void reverse_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL intrusive singly linked list.");
+
+    return;
+  }
+
+  IntrusiveLink *previous_link = NULL;
+  IntrusiveLink *current_link = intrusive_singly_linked_list->head_link;
+
+  while (current_link != NULL)
+  {
+    IntrusiveLink *next_link = current_link->next_link;
+
+    current_link->next_link = previous_link;
+    previous_link = current_link;
+    current_link = next_link;
+  }
+
+  intrusive_singly_linked_list->tail_link = intrusive_singly_linked_list->head_link;
+  intrusive_singly_linked_list->head_link = previous_link;
+}
+
+/**
+ * \brief Searches for the first element in the intrusive singly linked list that matches the provided key.
+ *
+ * The compare function of the list is called with every element and the key until it returns true.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to search in.
+ * \param key The key to search for.
+ *
+ * \return A pointer to the matching element, or `NULL` if no element is found.
+ */
+NodeData find_element_in_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData key)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for an element in a NULL intrusive singly linked list.");
+
+    return NULL;
+  }
+
+  for (IntrusiveLink *current_link = intrusive_singly_linked_list->head_link; current_link != NULL; current_link = current_link->next_link)
+  {
+    NodeData element = get_element_of_link(intrusive_singly_linked_list, current_link);
+
+    if (intrusive_singly_linked_list->compare_data_function(element, key))
+    {
+      return element;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Checks if an intrusive singly linked list is valid.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` to be checked.
+ *
+ * \return true if the intrusive singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list)
+{
+  return intrusive_singly_linked_list != NULL;
+}
+
+/**
+ * \brief Unlinks the link following another one, or the head link, from the intrusive singly linked list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` the link belongs to.
+ * \param previous_link A pointer to the link before the one to be unlinked, or `NULL` to unlink the head link.
+ * \param current_link A pointer to the link to be unlinked.
+ */
+static void unlink_intrusive_link(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, IntrusiveLink *previous_link, IntrusiveLink *current_link)
+{
+  if (previous_link == NULL)
+  {
+    intrusive_singly_linked_list->head_link = current_link->next_link;
+  }
+  else
+  {
+    previous_link->next_link = current_link->next_link;
+  }
+
+  if (intrusive_singly_linked_list->tail_link == current_link)
+  {
+    intrusive_singly_linked_list->tail_link = previous_link;
+  }
+
+  intrusive_singly_linked_list->length--;
+}
+
+/**
+ * \brief Deletes every element of the intrusive singly linked list that matches the provided key.
+ *
+ * The matching elements are unlinked and passed to the `free_data_function` of the list.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` from which elements will be deleted.
+ * \param key The key to search for. Elements matching it will be deleted.
+ *
+ * \return The number of elements that were deleted from the list.
+ */
+size_t delete_elements_from_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData key)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete an element on a NULL intrusive singly linked list.");
+
+    return 0;
+  }
+
+  size_t deleted_elements_count = 0;
+  IntrusiveLink *previous_link = NULL;
+  IntrusiveLink *current_link = intrusive_singly_linked_list->head_link;
+
+  while (current_link != NULL)
+  {
+    IntrusiveLink *next_link = current_link->next_link;
+    NodeData element = get_element_of_link(intrusive_singly_linked_list, current_link);
+
+    if (intrusive_singly_linked_list->compare_data_function(element, key))
+    {
+      unlink_intrusive_link(intrusive_singly_linked_list, previous_link, current_link);
+
+      intrusive_singly_linked_list->free_data_function(element);
+
+      deleted_elements_count++;
+    }
+    else
+    {
+      previous_link = current_link;
+    }
+
+    current_link = next_link;
+  }
+
+  return deleted_elements_count;
+}
+
+/**
+ * \brief Unlinks a specific element from the intrusive singly linked list without freeing it.
+ *
+ * The element is identified by its address rather than by comparison, and is handed back to the caller, who
+ * may insert it into another list or free it.
+ *
+ * \param intrusive_singly_linked_list A pointer to the `IntrusiveSinglyLinkedList` from which the element will be removed.
+ * \param element The element to be removed. This cannot be `NULL`.
+ *
+ * \return true if the element was found and unlinked, false otherwise.
+ */
+bool remove_element_from_intrusive_singly_linked_list(IntrusiveSinglyLinkedList *intrusive_singly_linked_list, NodeData element)
+{
+  if (!is_valid_intrusive_singly_linked_list(intrusive_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot remove an element from a NULL intrusive singly linked list.");
+
+    return false;
+  }
+
+  if (element == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot remove a NULL element.");
+
+    return false;
+  }
+
+  IntrusiveLink *removed_link = get_link_of_element(intrusive_singly_linked_list, element);
+  IntrusiveLink *previous_link = NULL;
+
+  for (IntrusiveLink *current_link = intrusive_singly_linked_list->head_link; current_link != NULL; current_link = current_link->next_link)
+  {
+    if (current_link == removed_link)
+    {
+      unlink_intrusive_link(intrusive_singly_linked_list, previous_link, current_link);
+
+      current_link->next_link = NULL;
+
+      return true;
+    }
+
+    previous_link = current_link;
+  }
+
+  return false;
+}
@@ -0,0 +1,410 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../include/node_pool.h"
+#include "../include/singly_linked_list.h"
+
+/**
+ * \struct NodeSlab
+ * \brief A structure representing a contiguous block of nodes owned by a node pool.
+ *
+ * The nodes are stored inline after the header, so a whole slab is allocated and freed with a single call.
+ */
+typedef struct NodeSlab
+{
+  struct NodeSlab *next_slab; /**< Pointer to the next slab owned by the pool, or `NULL` if this is the last one. */
+  size_t capacity;            /**< Number of nodes stored in this slab. */
+  size_t used_nodes;          /**< Number of nodes already handed out from this slab. */
+  Node nodes[];               /**< The nodes carved out of this slab. */
+} NodeSlab;
+
+/**
+ * \brief Allocates a new empty slab able to hold the given number of nodes.
+ *
+ * \param capacity The number of nodes the slab will hold.
+ *
+ * \return A pointer to the new slab, or `NULL` if the allocation fails.
+ */
+static NodeSlab *create_node_slab(size_t capacity)
+{
+  if (capacity > (SIZE_MAX - sizeof(NodeSlab)) / sizeof(Node))
+  {
+    return NULL;
+  }
+
+  NodeSlab *node_slab = (NodeSlab *)malloc(sizeof(NodeSlab) + capacity * sizeof(Node));
+
+  if (node_slab == NULL)
+  {
+    return NULL;
+  }
+
+  node_slab->next_slab = NULL;
+  node_slab->capacity = capacity;
+  node_slab->used_nodes = 0;
+
+  return node_slab;
+}
+
+/**
+ * \brief Moves the slabs and the free nodes of a node pool into another one in constant time.
+ *
+ * The sharing groups of the pools are left untouched.
+ *
+ * \param destination_node_pool A pointer to the `NodePool` that takes over the slabs and free nodes.
+ * \param source_node_pool A pointer to the `NodePool` whose slabs and free nodes are taken.
+ */
+static void transfer_node_pool_memory(NodePool *destination_node_pool, NodePool *source_node_pool)
+{
+  if (source_node_pool->slab_list != NULL)
+  {
+    if (destination_node_pool->slab_list == NULL)
+    {
+      destination_node_pool->slab_list = source_node_pool->slab_list;
+      destination_node_pool->last_slab = source_node_pool->last_slab;
+    }
+    else
+    {
+      if (destination_node_pool->slab_list->next_slab == NULL)
+      {
+        destination_node_pool->last_slab = source_node_pool->last_slab;
+      }
+
+      source_node_pool->last_slab->next_slab = destination_node_pool->slab_list->next_slab;
+
+      destination_node_pool->slab_list->next_slab = source_node_pool->slab_list;
+    }
+  }
+
+  if (source_node_pool->free_node_list != NULL)
+  {
+    if (destination_node_pool->free_node_list == NULL)
+    {
+      destination_node_pool->last_free_node = source_node_pool->last_free_node;
+    }
+
+    source_node_pool->last_free_node->next_node = destination_node_pool->free_node_list;
+
+    destination_node_pool->free_node_list = source_node_pool->free_node_list;
+  }
+
+  source_node_pool->slab_list = NULL;
+  source_node_pool->last_slab = NULL;
+  source_node_pool->free_node_list = NULL;
+  source_node_pool->last_free_node = NULL;
+}
+
+/**
+ * \brief Removes a node pool from its sharing group, if it has one.
+ *
+ * A group left with a single pool is dissolved, since that pool no longer shares its slabs with any other one.
+ *
+ * \param node_pool A pointer to the `NodePool` leaving its group.
+ */
+static void leave_sharing_group(NodePool *node_pool)
+{
+  NodePool *next_pool = node_pool->next_sharing_pool;
+  NodePool *previous_pool = node_pool->previous_sharing_pool;
+
+  if (next_pool == NULL)
+  {
+    return;
+  }
+
+  if (next_pool == previous_pool)
+  {
+    next_pool->next_sharing_pool = NULL;
+    next_pool->previous_sharing_pool = NULL;
+  }
+  else
+  {
+    previous_pool->next_sharing_pool = next_pool;
+    next_pool->previous_sharing_pool = previous_pool;
+  }
+
+  node_pool->next_sharing_pool = NULL;
+  node_pool->previous_sharing_pool = NULL;
+}
+
+/**
+ * \brief Initializes an empty node pool.
+ *
+ * This function sets the slab list and the free node list of the pool to `NULL` and leaves it out of any
+ * sharing group. No memory is allocated until the first node is requested.
+ *
+ * \param node_pool A pointer to the `NodePool` to be initialized.
+ */
+void initialize_node_pool(NodePool *node_pool)
+{
+  node_pool->slab_list = NULL;
+  node_pool->last_slab = NULL;
+  node_pool->free_node_list = NULL;
+  node_pool->last_free_node = NULL;
+  node_pool->next_sharing_pool = NULL;
+  node_pool->previous_sharing_pool = NULL;
+}
+
+/**
+ * \brief Allocates a node from the node pool.
+ *
+ * This function first reuses a node from the free node list if there is one. Otherwise it hands out the next
+ * unused node of the current slab, allocating a new slab of `NODE_POOL_SLAB_CAPACITY` nodes when the current
+ * one is exhausted. The returned node is not initialized.
+ *
+ * \param node_pool A pointer to the `NodePool` to allocate the node from.
+ *
+ * \return A pointer to the allocated node, or `NULL` if a new slab could not be allocated.
+ */
+Node *allocate_node_from_pool(NodePool *node_pool)
+{
+  if (node_pool->free_node_list != NULL)
+  {
+    Node *node = node_pool->free_node_list;
+
+    node_pool->free_node_list = node->next_node;
+
+    return node;
+  }
+
+  NodeSlab *current_slab = node_pool->slab_list;
+
+  if (current_slab == NULL || current_slab->used_nodes == current_slab->capacity)
+  {
+    current_slab = create_node_slab(NODE_POOL_SLAB_CAPACITY);
+
+    if (current_slab == NULL)
+    {
+      return NULL;
+    }
+
+    if (node_pool->slab_list == NULL)
+    {
+      node_pool->last_slab = current_slab;
+    }
+
+    current_slab->next_slab = node_pool->slab_list;
+
+    node_pool->slab_list = current_slab;
+  }
+
+  return &current_slab->nodes[current_slab->used_nodes++];
+}
+
+/**
+ * \brief Allocates a contiguous run of nodes from the node pool.
+ *
+ * If the current slab has enough unused nodes left, the run is carved out of it. Otherwise a dedicated
+ * slab of exactly `node_count` nodes is allocated for the run, leaving the current slab in place for
+ * later single-node allocations. The free node list is never used, since its nodes are not contiguous.
+ * The returned nodes are not initialized, and each of them can later be released individually.
+ *
+ * \param node_pool A pointer to the `NodePool` to allocate the nodes from.
+ * \param node_count The number of nodes to allocate. This must be greater than 0.
+ *
+ * \return A pointer to the first node of the run, or `NULL` if a new slab could not be allocated.
+ */
+Node *allocate_node_run_from_pool(NodePool *node_pool, size_t node_count)
+{
+  NodeSlab *current_slab = node_pool->slab_list;
+
+  if (current_slab != NULL && current_slab->capacity - current_slab->used_nodes >= node_count)
+  {
+    Node *first_node = &current_slab->nodes[current_slab->used_nodes];
+
+    current_slab->used_nodes += node_count;
+
+    return first_node;
+  }
+
+  NodeSlab *dedicated_slab = create_node_slab(node_count);
+
+  if (dedicated_slab == NULL)
+  {
+    return NULL;
+  }
+
+  dedicated_slab->used_nodes = node_count;
+
+  if (current_slab == NULL)
+  {
+    dedicated_slab->next_slab = NULL;
+
+    node_pool->slab_list = dedicated_slab;
+    node_pool->last_slab = dedicated_slab;
+  }
+  else
+  {
+    if (current_slab->next_slab == NULL)
+    {
+      node_pool->last_slab = dedicated_slab;
+    }
+
+    dedicated_slab->next_slab = current_slab->next_slab;
+
+    current_slab->next_slab = dedicated_slab;
+  }
+
+  return dedicated_slab->nodes;
+}
+
+/**
+ * \brief Releases a node back to the node pool.
+ *
+ * This function pushes the node onto the free node list of the pool so that it can be reused by a later
+ * allocation. The node must have been allocated from the same pool.
+ *
+ * \param node_pool A pointer to the `NodePool` that owns the node.
+ * \param node A pointer to the node to be released.
+ */
+void release_node_to_pool(NodePool *node_pool, Node *node)
+{
+  if (node_pool->free_node_list == NULL)
+  {
+    node_pool->last_free_node = node;
+  }
+
+  node->next_node = node_pool->free_node_list;
+  node_pool->free_node_list = node;
+}
+
+/**
+ * \brief Releases a chain of nodes back to the node pool at once.
+ *
+ * This function links the last node of the chain to the free node list of the pool and makes the first node its
+ * new head, so releasing the chain takes constant time whatever its length. The nodes must be linked from
+ * `first_node` to `last_node` through their `next_node` pointers and must have been allocated from the same pool.
+ *
+ * \param node_pool A pointer to the `NodePool` that owns the nodes.
+ * \param first_node A pointer to the first node of the chain.
+ * \param last_node A pointer to the last node of the chain.
+ */
+void release_node_chain_to_pool(NodePool *node_pool, Node *first_node, Node *last_node)
+{
+  if (node_pool->free_node_list == NULL)
+  {
+    node_pool->last_free_node = last_node;
+  }
+
+  last_node->next_node = node_pool->free_node_list;
+  node_pool->free_node_list = first_node;
+}
+
+/**
+ * \brief Moves every slab and free node of a node pool into another one.
+ *
+ * The slabs of the source pool are linked after the current slab of the destination pool, which keeps handing
+ * out nodes, and the free node list of the source pool is prepended to the one of the destination pool, in
+ * constant time. Every node allocated from either pool stays valid and is owned by the destination pool
+ * afterwards, and the source pool is left empty. If the source pool was shared, the destination pool takes its
+ * place in its sharing group, which takes time proportional to the size of the groups involved.
+ *
+ * \param destination_node_pool A pointer to the `NodePool` that takes over the slabs and free nodes.
+ * \param source_node_pool A pointer to the `NodePool` to be emptied. It must not be the destination pool.
+ */
+void merge_node_pools(NodePool *destination_node_pool, NodePool *source_node_pool)
+{
+  transfer_node_pool_memory(destination_node_pool, source_node_pool);
+
+  if (source_node_pool->next_sharing_pool != NULL)
+  {
+    share_node_pools(destination_node_pool, source_node_pool);
+    leave_sharing_group(source_node_pool);
+  }
+}
+
+/**
+ * \brief Puts two node pools in the same sharing group.
+ *
+ * After this call, nodes allocated from either pool may be handed over to the list of the other one, and the
+ * slabs of both pools are only returned to the system once every pool of the group has been destroyed. If the
+ * pools are already in different groups, the groups are joined. This takes time proportional to the size of the
+ * group of `node_pool`.
+ *
+ * \param node_pool A pointer to the first `NodePool`.
+ * \param other_node_pool A pointer to the second `NodePool`. It must not be the first pool.
+ */
+void share_node_pools(NodePool *node_pool, NodePool *other_node_pool)
+{
+  if (node_pool->next_sharing_pool != NULL)
+  {
+    for (NodePool *member_pool = node_pool->next_sharing_pool; member_pool != node_pool; member_pool = member_pool->next_sharing_pool)
+    {
+      if (member_pool == other_node_pool)
+      {
+        return;
+      }
+    }
+  }
+  else
+  {
+    node_pool->next_sharing_pool = node_pool;
+    node_pool->previous_sharing_pool = node_pool;
+  }
+
+  if (other_node_pool->next_sharing_pool == NULL)
+  {
+    other_node_pool->next_sharing_pool = other_node_pool;
+    other_node_pool->previous_sharing_pool = other_node_pool;
+  }
+
+  NodePool *next_pool = node_pool->next_sharing_pool;
+  NodePool *other_previous_pool = other_node_pool->previous_sharing_pool;
+
+  node_pool->next_sharing_pool = other_node_pool;
+  other_node_pool->previous_sharing_pool = node_pool;
+  other_previous_pool->next_sharing_pool = next_pool;
+  next_pool->previous_sharing_pool = other_previous_pool;
+}
+
+/**
+ * \brief Moves a node pool to another location, keeping its sharing group pointing to it.
+ *
+ * \param destination_node_pool A pointer to the uninitialized or empty and unshared `NodePool` that takes the place of the source pool.
+ * \param source_node_pool A pointer to the `NodePool` to be moved. It is left empty and unshared.
+ */
+void move_node_pool(NodePool *destination_node_pool, NodePool *source_node_pool)
+{
+  *destination_node_pool = *source_node_pool;
+
+  if (destination_node_pool->next_sharing_pool != NULL)
+  {
+    destination_node_pool->previous_sharing_pool->next_sharing_pool = destination_node_pool;
+    destination_node_pool->next_sharing_pool->previous_sharing_pool = destination_node_pool;
+  }
+
+  initialize_node_pool(source_node_pool);
+}
+
+/**
+ * \brief Destroys a node pool, returning all of its slabs at once.
+ *
+ * This function frees every slab owned by the pool, which invalidates every node allocated from it, and
+ * leaves the pool empty and ready to be used again. If the pool is shared, its slabs may still hold nodes of
+ * the other pools of its group, so they are handed over to one of them instead and the pool leaves the group.
+ *
+ * \param node_pool A pointer to the `NodePool` to be destroyed.
+ */
+void destroy_node_pool(NodePool *node_pool)
+{
+  if (node_pool->next_sharing_pool != NULL)
+  {
+    transfer_node_pool_memory(node_pool->next_sharing_pool, node_pool);
+    leave_sharing_group(node_pool);
+
+    return;
+  }
+
+  NodeSlab *current_slab = node_pool->slab_list;
+  NodeSlab *next_slab = NULL;
+
+  while (current_slab != NULL)
+  {
+    next_slab = current_slab->next_slab;
+
+    free(current_slab);
+
+    current_slab = next_slab;
+  }
+
+  initialize_node_pool(node_pool);
+}
@@ -0,0 +1,465 @@
+#include <sched.h>
+#include <stdlib.h>
+
+#include "../include/rcu_singly_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Frees a node retired from a read-copy-update singly linked list, along with its data.
+ *
+ * \param node A pointer to the retired `RcuNode`.
+ */
+static void reclaim_rcu_node(void *node)
+{
+  RcuNode *rcu_node = (RcuNode *)node;
+
+  if (rcu_node->free_data_function != NULL)
+  {
+    rcu_node->free_data_function(rcu_node->node_data);
+  }
+
+  free(rcu_node);
+}
+
+/**
+ * \brief Creates a new read-copy-update singly linked list.
+ *
+ * This function allocates memory for a new `RcuSinglyLinkedList`, initializes its writer mutex and its
+ * epoch domain. If a function pointer is NULL or an allocation fails, an error message is printed and the
+ * function returns `NULL`.
+ *
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ *
+ * \return A pointer to the newly created `RcuSinglyLinkedList` if successful, or `NULL` if an error occurs.
+ */
+RcuSinglyLinkedList *create_rcu_singly_linked_list(FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
+{
+  if (free_data_function == NULL || compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' and 'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  RcuSinglyLinkedList *rcu_singly_linked_list = (RcuSinglyLinkedList *)aligned_alloc(_Alignof(RcuSinglyLinkedList), sizeof(RcuSinglyLinkedList));
+
+  if (rcu_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'rcu_singly_linked_list'.");
+
+    return NULL;
+  }
+
+  if (pthread_mutex_init(&rcu_singly_linked_list->writer_mutex, NULL) != 0)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Initialization failed for 'writer_mutex'.");
+
+    free(rcu_singly_linked_list);
+
+    return NULL;
+  }
+
+  atomic_init(&rcu_singly_linked_list->head_node, NULL);
+  atomic_init(&rcu_singly_linked_list->length, 0);
+
+  rcu_singly_linked_list->free_data_function = free_data_function;
+  rcu_singly_linked_list->compare_data_function = compare_data_function;
+
+  initialize_epoch_domain(&rcu_singly_linked_list->epoch_domain, reclaim_rcu_node);
+
+  return rcu_singly_linked_list;
+}
+
+/**
+ * \brief Registers the calling thread with a read-copy-update singly linked list.
+ *
+ * Every thread that reads or modifies the list needs its own epoch record, which it passes to the other
+ * functions of the list and gives back with `unregister_rcu_singly_linked_list_thread`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list the thread will use.
+ *
+ * \return A pointer to the epoch record of the thread, or `NULL` if none is available.
+ */
+EpochRecord *register_rcu_singly_linked_list_thread(RcuSinglyLinkedList *rcu_singly_linked_list)
+{
+  if (rcu_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot register a thread on a NULL RCU singly linked list.");
+
+    return NULL;
+  }
+
+  return acquire_epoch_record(&rcu_singly_linked_list->epoch_domain);
+}
+
+/**
+ * \brief Gives back the epoch record of a thread that no longer uses the list.
+ *
+ * \param epoch_record A pointer to the record returned by `register_rcu_singly_linked_list_thread`.
+ */
+void unregister_rcu_singly_linked_list_thread(EpochRecord *epoch_record)
+{
+  if (epoch_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot unregister a NULL epoch record.");
+
+    return;
+  }
+
+  release_epoch_record(epoch_record);
+}
+
+/**
+ * \brief Enters a read-side critical section of the list.
+ *
+ * The data returned by `find_node_data_in_rcu_list` stays valid until the matching call to
+ * `exit_rcu_read_section`, even if a writer deletes or replaces it in the meantime. Read sections can be nested.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be read.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void enter_rcu_read_section(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record)
+{
+  enter_epoch_critical_section(&rcu_singly_linked_list->epoch_domain, epoch_record);
+}
+
+/**
+ * \brief Leaves a read-side critical section entered with `enter_rcu_read_section`.
+ *
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void exit_rcu_read_section(EpochRecord *epoch_record)
+{
+  exit_epoch_critical_section(epoch_record);
+}
+
+/**
+ * \brief Finds the data of the first node matching a key without taking any lock.
+ *
+ * This function traverses the list with acquire loads inside its own read section, so it can run at the
+ * same time as writers. The returned data may be reclaimed as soon as the read section ends, so a caller
+ * that uses it must wrap the call and every use of the data in `enter_rcu_read_section` and `exit_rcu_read_section`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be searched.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ *
+ * \return The data of the first matching node, or `NULL` if no node matches or an error occurs.
+ */
+NodeData find_node_data_in_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key)
+{
+  if (rcu_singly_linked_list == NULL || epoch_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot search without an RCU singly linked list and an epoch record.");
+
+    return NULL;
+  }
+
+  NodeData found_node_data = NULL;
+
+  enter_epoch_critical_section(&rcu_singly_linked_list->epoch_domain, epoch_record);
+
+  RcuNode *current_node = atomic_load_explicit(&rcu_singly_linked_list->head_node, memory_order_acquire);
+
+  while (current_node != NULL)
+  {
+    if (rcu_singly_linked_list->compare_data_function(current_node->node_data, key))
+    {
+      found_node_data = current_node->node_data;
+
+      break;
+    }
+
+    current_node = atomic_load_explicit(&current_node->next_node, memory_order_acquire);
+  }
+
+  exit_epoch_critical_section(epoch_record);
+
+  return found_node_data;
+}
+
+/**
+ * \brief Inserts a new node at the head of the read-copy-update singly linked list.
+ *
+ * The node is fully initialized before it is published with a release store, so a reader that reaches
+ * it always sees its data.
+ *
+ * \param rcu_singly_linked_list A pointer to the list where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return true if the node was inserted, false if an error occurred.
+ */
+bool insert_node_at_rcu_head(RcuSinglyLinkedList *rcu_singly_linked_list, NodeData node_data)
+{
+  if (rcu_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL RCU singly linked list.");
+
+    return false;
+  }
+
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert NULL data in an RCU singly linked list.");
+
+    return false;
+  }
+
+  RcuNode *new_node = (RcuNode *)malloc(sizeof(RcuNode));
+
+  if (new_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'new_node'.");
+
+    return false;
+  }
+
+  new_node->node_data = node_data;
+  new_node->free_data_function = NULL;
+
+  pthread_mutex_lock(&rcu_singly_linked_list->writer_mutex);
+
+  atomic_init(&new_node->next_node, atomic_load_explicit(&rcu_singly_linked_list->head_node, memory_order_relaxed));
+  atomic_store_explicit(&rcu_singly_linked_list->head_node, new_node, memory_order_release);
+  atomic_fetch_add_explicit(&rcu_singly_linked_list->length, 1, memory_order_relaxed);
+
+  pthread_mutex_unlock(&rcu_singly_linked_list->writer_mutex);
+
+  return true;
+}
+
+/**
+ * \brief Finds the link leading to the first node matching a key.
+ *
+ * The caller must hold the writer mutex, so the links can be read with relaxed loads.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be searched.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ *
+ * \return A pointer to `head_node` or to the `next_node` of the predecessor of the matching node, or `NULL` if no node matches.
+ */
+static _Atomic(RcuNode *) *find_link_to_matching_rcu_node(RcuSinglyLinkedList *rcu_singly_linked_list, NodeData key)
+{
+  _Atomic(RcuNode *) *current_link = &rcu_singly_linked_list->head_node;
+  RcuNode *current_node = atomic_load_explicit(current_link, memory_order_relaxed);
+
+  while (current_node != NULL)
+  {
+    if (rcu_singly_linked_list->compare_data_function(current_node->node_data, key))
+    {
+      return current_link;
+    }
+
+    current_link = &current_node->next_node;
+    current_node = atomic_load_explicit(current_link, memory_order_relaxed);
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Deletes the first node matching a key from the read-copy-update singly linked list.
+ *
+ * The node is unlinked with a release store to the pointer leading to it, so readers that have not reached
+ * it yet skip it while readers already on it can still follow its `next_node`. It is then retired, and the
+ * node and its data are freed after a grace period.
+ *
+ * \param rcu_singly_linked_list A pointer to the list from which the node will be deleted.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ *
+ * \return true if a node was deleted, false if no node matches or an error occurs.
+ */
+bool delete_node_from_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key)
+{
+  if (rcu_singly_linked_list == NULL || epoch_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot delete a node without an RCU singly linked list and an epoch record.");
+
+    return false;
+  }
+
+  pthread_mutex_lock(&rcu_singly_linked_list->writer_mutex);
+
+  _Atomic(RcuNode *) *matching_link = find_link_to_matching_rcu_node(rcu_singly_linked_list, key);
+
+  if (matching_link == NULL)
+  {
+    pthread_mutex_unlock(&rcu_singly_linked_list->writer_mutex);
+
+    return false;
+  }
+
+  RcuNode *matching_node = atomic_load_explicit(matching_link, memory_order_relaxed);
+
+  atomic_store_explicit(matching_link, atomic_load_explicit(&matching_node->next_node, memory_order_relaxed), memory_order_release);
+  atomic_fetch_sub_explicit(&rcu_singly_linked_list->length, 1, memory_order_relaxed);
+
+  matching_node->free_data_function = rcu_singly_linked_list->free_data_function;
+
+  retire_epoch_pointer(&rcu_singly_linked_list->epoch_domain, epoch_record, matching_node);
+
+  pthread_mutex_unlock(&rcu_singly_linked_list->writer_mutex);
+
+  return true;
+}
+
+/**
+ * \brief Replaces the data of the first node matching a key with a copy of the node holding new data.
+ *
+ * The copy takes the place of the matching node with a single release store, so every reader sees either
+ * the old data or the new data, never a mix. The old node and its data are freed after a grace period.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be updated.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ * \param key The key compared to the data of every node with the `compare_data_function` of the list.
+ * \param new_node_data The data replacing the data of the matching node. This cannot be `NULL`.
+ *
+ * \return true if a node was replaced, false if no node matches or an error occurs, in which case the caller keeps ownership of `new_node_data`.
+ */
+bool replace_node_data_in_rcu_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record, NodeData key, NodeData new_node_data)
+{
+  if (rcu_singly_linked_list == NULL || epoch_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot replace a node without an RCU singly linked list and an epoch record.");
+
+    return false;
+  }
+
+  if (new_node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot store NULL data in an RCU singly linked list.");
+
+    return false;
+  }
+
+  RcuNode *new_node = (RcuNode *)malloc(sizeof(RcuNode));
+
+  if (new_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'new_node'.");
+
+    return false;
+  }
+
+  new_node->node_data = new_node_data;
+  new_node->free_data_function = NULL;
+
+  pthread_mutex_lock(&rcu_singly_linked_list->writer_mutex);
+
+  _Atomic(RcuNode *) *matching_link = find_link_to_matching_rcu_node(rcu_singly_linked_list, key);
+
+  if (matching_link == NULL)
+  {
+    pthread_mutex_unlock(&rcu_singly_linked_list->writer_mutex);
+
+    free(new_node);
+
+    return false;
+  }
+
+  RcuNode *matching_node = atomic_load_explicit(matching_link, memory_order_relaxed);
+
+  atomic_init(&new_node->next_node, atomic_load_explicit(&matching_node->next_node, memory_order_relaxed));
+  atomic_store_explicit(matching_link, new_node, memory_order_release);
+
+  matching_node->free_data_function = rcu_singly_linked_list->free_data_function;
+
+  retire_epoch_pointer(&rcu_singly_linked_list->epoch_domain, epoch_record, matching_node);
+
+  pthread_mutex_unlock(&rcu_singly_linked_list->writer_mutex);
+
+  return true;
+}
+
+/**
+ * \brief Waits for a grace period, then reclaims the nodes retired by the calling thread.
+ *
+ * When this function returns, every reader that was inside a read section when it was called has left it.
+ * The calling thread must not be inside a read section itself, since it would wait for itself forever.
+ *
+ * \param rcu_singly_linked_list A pointer to the list whose grace period is awaited.
+ * \param epoch_record A pointer to the epoch record of the calling thread.
+ */
+void synchronize_rcu_singly_linked_list(RcuSinglyLinkedList *rcu_singly_linked_list, EpochRecord *epoch_record)
+{
+  if (rcu_singly_linked_list == NULL || epoch_record == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot wait for a grace period without an RCU singly linked list and an epoch record.");
+
+    return;
+  }
+
+  EpochDomain *epoch_domain = &rcu_singly_linked_list->epoch_domain;
+  size_t grace_period_epoch = atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire) + 2;
+
+  /* A reader that stays inside its read section keeps the epoch from moving more than one past the one it announced. */
+  while (atomic_load_explicit(&epoch_domain->global_epoch, memory_order_acquire) < grace_period_epoch)
+  {
+    if (!try_advance_epoch(epoch_domain))
+    {
+      sched_yield();
+    }
+  }
+
+  reclaim_epoch_retired_pointers(epoch_domain, epoch_record);
+}
+
+/**
+ * \brief Returns the number of nodes in the read-copy-update singly linked list.
+ *
+ * The value is exact when no writer is modifying the list, and a recent snapshot otherwise.
+ *
+ * \param rcu_singly_linked_list A pointer to the list whose length is to be returned.
+ *
+ * \return The number of nodes in the list, or 0 if the list is invalid.
+ */
+size_t get_rcu_singly_linked_list_length(RcuSinglyLinkedList *rcu_singly_linked_list)
+{
+  if (rcu_singly_linked_list == NULL)
+  {
+    return 0;
+  }
+
+  return atomic_load_explicit(&rcu_singly_linked_list->length, memory_order_relaxed);
+}
+
+/**
+ * \brief Frees all the nodes of the read-copy-update singly linked list and every node still retired.
+ *
+ * No thread may be using the list while it is freed. Afterward, the list is empty and its writer mutex is
+ * destroyed, so it can only be released with `free`.
+ *
+ * \param rcu_singly_linked_list A pointer to the list to be freed.
+ */
+void free_rcu_singly_linked_list(RcuSinglyLinkedList *rcu_singly_linked_list)
+{
+  if (rcu_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL RCU singly linked list.");
+
+    return;
+  }
+
+  RcuNode *current_node = atomic_load_explicit(&rcu_singly_linked_list->head_node, memory_order_acquire);
+  RcuNode *next_node = NULL;
+
+  while (current_node != NULL)
+  {
+    next_node = atomic_load_explicit(&current_node->next_node, memory_order_relaxed);
+
+    rcu_singly_linked_list->free_data_function(current_node->node_data);
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  destroy_epoch_domain(&rcu_singly_linked_list->epoch_domain);
+
+  pthread_mutex_destroy(&rcu_singly_linked_list->writer_mutex);
+
+  atomic_store_explicit(&rcu_singly_linked_list->head_node, NULL, memory_order_relaxed);
+  atomic_store_explicit(&rcu_singly_linked_list->length, 0, memory_order_relaxed);
+}
@@ -1,7 +1,76 @@
-#include <stdio.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "../include/hash_index.h"
 #include "../include/singly_linked_list.h"
+#include "../include/singly_linked_list_compaction.h"
+#include "../include/skip_list_index.h"
+
+/**
+ * \brief Hints the processor to fetch the cache line holding an address for reading.
+ *
+ * Compilers without `__builtin_prefetch` ignore the hint. Prefetching an invalid address, including `NULL`,
+ * does not fault.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH_FOR_READ(address) __builtin_prefetch((address), 0, 3)
+#else
+#define PREFETCH_FOR_READ(address) ((void)(address))
+#endif
+
+/**
+ * \brief Moves the lookahead node of a traversal one position forward, prefetching what the traversal will need.
+ *
+ * The lookahead node is read to find its successor, so the data it points to and the successor itself are
+ * prefetched while the traversal catches up.
+ *
+ * \param lookahead_node The lookahead node, or `NULL` when it has run past the tail or prefetching is disabled.
+ *
+ * \return The node after the lookahead node, or `NULL`.
+ */
+static inline Node *advance_lookahead_node(Node *lookahead_node)
+{
+  if (lookahead_node == NULL)
+  {
+    return NULL;
+  }
+
+  Node *next_node = lookahead_node->next_node;
+
+  PREFETCH_FOR_READ(lookahead_node->node_data);
+  PREFETCH_FOR_READ(next_node);
+
+  return next_node;
+}
+
+/**
+ * \brief Returns the lookahead node for a traversal starting at a node, prefetching the nodes in between.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose prefetch distance is used.
+ * \param first_node The node the traversal starts at.
+ *
+ * \return The node `prefetch_distance` positions after `first_node`, or `NULL` if prefetching is disabled or
+ * the list is shorter.
+ */
+static Node *start_lookahead_node(SinglyLinkedList *singly_linked_list, Node *first_node)
+{
+  if (singly_linked_list->prefetch_distance == 0)
+  {
+    return NULL;
+  }
+
+  Node *lookahead_node = first_node;
+
+  PREFETCH_FOR_READ(first_node);
+
+  for (size_t node_index = 0; node_index < singly_linked_list->prefetch_distance && lookahead_node != NULL; node_index++)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+  }
+
+  return lookahead_node;
+}
 
 /**
  * \brief Creates a new singly linked list with the provided function pointers.
@@ -9,8 +78,8 @@
  * This function allocates memory for a new `SinglyLinkedList` structure, initializes its fields,
  * and sets the function pointers for printing, freeing, and comparing node data. It performs
  * checks to ensure that none of the function pointers are NULL, and if any are, an error
- * message is printed and the function returns `NULL`. If memory allocation for the singly linked list
- * fails, an error message is also printed.
+ * is reported and the function returns `NULL`. If memory allocation for the singly linked list
+ * fails, an error is also reported.
  *
  * \param print_data_function A function pointer used to print the data of a node.
  * \param free_data_function A function pointer used to free the data of a node.
@@ -20,43 +89,90 @@
  */
 SinglyLinkedList *create_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
 {
+  SinglyLinkedList *singly_linked_list = NULL;
+
+  try_create_singly_linked_list(print_data_function, free_data_function, compare_data_function, &singly_linked_list);
+
+  return singly_linked_list;
+}
+
+/**
+ * \brief Creates a new singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `create_singly_linked_list`, but returns a status instead of `NULL` on failure.
+ *
+ * \param print_data_function A function pointer used to print the data of a node.
+ * \param free_data_function A function pointer used to free the data of a node.
+ * \param compare_data_function A function pointer used to compare the data of two nodes.
+ * \param created_singly_linked_list Where the new list is stored on success. It is set to `NULL` on failure.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be created.
+ */
+SinglyLinkedListStatus try_create_singly_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function, SinglyLinkedList **created_singly_linked_list)
+{
+  if (created_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'created_singly_linked_list' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  *created_singly_linked_list = NULL;
+
   if (print_data_function == NULL)
   {
-    printf("[ERROR] 'print_data_function' cannot be NULL.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
   }
 
   if (free_data_function == NULL)
   {
-    printf("[ERROR] 'free_data_function' cannot be NULL.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
   }
 
   if (compare_data_function == NULL)
   {
-    printf("[ERROR] 'compare_data_function' cannot be NULL.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
   }
 
   SinglyLinkedList *singly_linked_list = (SinglyLinkedList *)malloc(sizeof(SinglyLinkedList));
 
   if (singly_linked_list == NULL)
   {
-    printf("[ERROR] Memory allocation failed for 'singly_linked_list'.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'singly_linked_list'.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
   }
 
   singly_linked_list->head_node = NULL;
   singly_linked_list->tail_node = NULL;
+  singly_linked_list->length = 0;
   singly_linked_list->print_data_function = print_data_function;
   singly_linked_list->free_data_function = free_data_function;
   singly_linked_list->compare_data_function = compare_data_function;
+  singly_linked_list->order_data_function = NULL;
+  singly_linked_list->free_data_batch_function = NULL;
 
-  return singly_linked_list;
+  initialize_node_pool(&singly_linked_list->node_pool);
+
+  singly_linked_list->hash_index = NULL;
+  singly_linked_list->skip_list_index = NULL;
+  singly_linked_list->prefetch_distance = SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE;
+
+  initialize_node_pool(&singly_linked_list->compaction_source_pool);
+
+  singly_linked_list->last_compacted_node = NULL;
+  singly_linked_list->compaction_end_node = NULL;
+  singly_linked_list->is_compacting = false;
+
+  *created_singly_linked_list = singly_linked_list;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
@@ -64,8 +180,8 @@ SinglyLinkedList *create_singly_linked_list(PrintDataFunction print_data_functio
  *
  * This function allocates memory for a new `Node` structure, sets its data to the provided
  * `node_data`, and initializes its `next_node` pointer to `NULL`. It checks if the `node_data`
- * is `NULL` before proceeding, and if so, prints an error message and returns `NULL`. It also
- * checks for memory allocation failure and prints an error message if allocation fails.
+ * is `NULL` before proceeding, and if so, reports an error and returns `NULL`. It also
+ * checks for memory allocation failure and reports an error if allocation fails.
  *
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  *
@@ -73,26 +189,146 @@ SinglyLinkedList *create_singly_linked_list(PrintDataFunction print_data_functio
  */
 Node *create_node(NodeData node_data)
 {
+  Node *node = NULL;
+
+  try_create_node(node_data, &node);
+
+  return node;
+}
+
+/**
+ * \brief Creates a new node with the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `create_node`, but returns a status instead of `NULL` on failure.
+ *
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ * \param created_node Where the new node is stored on success. It is set to `NULL` on failure.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be created.
+ */
+SinglyLinkedListStatus try_create_node(NodeData node_data, Node **created_node)
+{
+  if (created_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'created_node' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  *created_node = NULL;
+
   if (node_data == NULL)
   {
-    printf("[ERROR] You cannot create a new node with a NULL value.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot create a new node with a NULL value.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_NULL_DATA;
   }
 
   Node *node = (Node *)malloc(sizeof(Node));
 
   if (node == NULL)
   {
-    printf("[ERROR] Memory allocation failed for 'node'.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node'.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
   }
 
   node->node_data = node_data;
   node->next_node = NULL;
 
-  return node;
+  *created_node = node;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Creates a new node with the provided data from the node pool of a singly linked list.
+ *
+ * This function behaves like `try_create_node`, but takes the memory for the node from the node pool
+ * of the singly linked list instead of calling `malloc`. The node must be returned to the same pool.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose node pool is used.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ * \param created_node Where the new node is stored on success.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be created.
+ */
+static SinglyLinkedListStatus create_pooled_node(SinglyLinkedList *singly_linked_list, NodeData node_data, Node **created_node)
+{
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot create a new node with a NULL value.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_DATA;
+  }
+
+  Node *node = allocate_node_from_pool(&singly_linked_list->node_pool);
+
+  if (node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node'.");
+
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  node->node_data = node_data;
+  node->next_node = NULL;
+
+  *created_node = node;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Returns a node that was just unlinked from the singly linked list to the pool it belongs to.
+ *
+ * While an incremental compaction is in progress, the node may belong to the set aside pool, so it is released
+ * there, where it is never handed out again, and its predecessor takes its place if it was the last node moved
+ * or the last node to move.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` the node was unlinked from.
+ * \param node A pointer to the unlinked node.
+ * \param previous_node A pointer to the node that preceded it, or `NULL` if it was the head.
+ */
+static void release_unlinked_node(SinglyLinkedList *singly_linked_list, Node *node, Node *previous_node)
+{
+  if (!singly_linked_list->is_compacting)
+  {
+    release_node_to_pool(&singly_linked_list->node_pool, node);
+
+    return;
+  }
+
+  if (singly_linked_list->last_compacted_node == node)
+  {
+    singly_linked_list->last_compacted_node = previous_node;
+  }
+
+  if (singly_linked_list->compaction_end_node == node)
+  {
+    singly_linked_list->compaction_end_node = previous_node;
+  }
+
+  release_node_to_pool(&singly_linked_list->compaction_source_pool, node);
+}
+
+/**
+ * \brief Adds a node that was just linked into the singly linked list to its hash index, if it has one.
+ *
+ * If the index cannot be grown to hold the node, it is detached from the list rather than left out
+ * of sync, and an error is reported. The node itself stays in the list.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` the node belongs to.
+ * \param node A pointer to the node to be indexed.
+ */
+static void index_inserted_node(SinglyLinkedList *singly_linked_list, Node *node)
+{
+  if (singly_linked_list->hash_index != NULL && !insert_node_into_hash_index(singly_linked_list->hash_index, node))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "The hash index could not be updated and has been detached.");
+
+    detach_hash_index(singly_linked_list);
+  }
 }
 
 /**
@@ -102,26 +338,41 @@ Node *create_node(NodeData node_data)
  * of the singly linked list. If the singly linked list is empty (i.e., `head_node` is `NULL`), the new node
  * becomes both the head and the tail of the list. If the list already has nodes, the new node
  * is inserted at the front, and the previous head becomes the second node. The function also
- * checks if the node creation fails and prints an error message if necessary.
+ * checks if the node creation fails and reports an error if necessary.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  */
 void insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  try_insert_node_at_head(singly_linked_list, node_data);
+}
+
+/**
+ * \brief Inserts a new node at the head of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_at_head`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_data)
 {
   if (!is_valid_singly_linked_list(singly_linked_list))
   {
-    printf("[ERROR] You cannot insert a node on a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL singly linked list.");
 
-    return;
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
   }
 
-  Node *new_node = create_node(node_data);
+  Node *new_node = NULL;
+  SinglyLinkedListStatus status = create_pooled_node(singly_linked_list, node_data, &new_node);
 
-  if (new_node == NULL)
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
   {
-    printf("[ERROR] An error occurred while creating a new node.\n");
-    return;
+    return status;
   }
 
   if (singly_linked_list->head_node == NULL)
@@ -134,6 +385,13 @@ void insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_dat
     new_node->next_node = singly_linked_list->head_node;
     singly_linked_list->head_node = new_node;
   }
+
+  singly_linked_list->length++;
+
+  index_inserted_node(singly_linked_list, new_node);
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
@@ -143,26 +401,41 @@ void insert_node_at_head(SinglyLinkedList *singly_linked_list, NodeData node_dat
  * tail of the singly linked list. If the list is empty (i.e., `head_node` is `NULL`), the new node
  * becomes both the head and the tail of the list. If the list already has nodes, the new node
  * is added after the current tail. The function also checks if the node creation fails and
- * prints an error message if necessary.
+ * reports an error if necessary.
  *
  * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
  * \param node_data The data to be stored in the new node. This cannot be `NULL`.
  */
 void insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  try_insert_node_at_tail(singly_linked_list, node_data);
+}
+
+/**
+ * \brief Inserts a new node at the tail of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_at_tail`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_data)
 {
   if (!is_valid_singly_linked_list(singly_linked_list))
   {
-    printf("[ERROR] You cannot insert a node on a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL singly linked list.");
 
-    return;
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
   }
 
-  Node *new_node = create_node(node_data);
+  Node *new_node = NULL;
+  SinglyLinkedListStatus status = create_pooled_node(singly_linked_list, node_data, &new_node);
 
-  if (new_node == NULL)
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
   {
-    printf("[ERROR] An error occurred while creating a new node.\n");
-    return;
+    return status;
   }
 
   if (singly_linked_list->head_node == NULL)
@@ -173,132 +446,419 @@ void insert_node_at_tail(SinglyLinkedList *singly_linked_list, NodeData node_dat
   else
   {
     singly_linked_list->tail_node->next_node = new_node;
+    singly_linked_list->tail_node = new_node;
   }
+
+  singly_linked_list->length++;
+
+  index_inserted_node(singly_linked_list, new_node);
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
- * \brief Prints all the nodes in the singly linked list.
+ * \brief Creates a contiguous run of nodes holding the provided data from the node pool of a singly linked list.
  *
- * This function iterates through the entire singly linked list starting from the head node and
- * prints the data stored in each node using the `print_data_function` provided during
- * the creation of the singly linked list. The function continues until it reaches the end of the list,
- * where the `next_node` is `NULL`.
+ * This function checks every element of `node_data_array` before allocating anything, so that
+ * a failed bulk insertion leaves the list untouched. The `next_node` pointers of the nodes are not set.
  *
- * \param singly_linked_list A pointer to the `SinglyLinkedList` to be printed.
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose node pool is used.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`. This must be greater than 0.
+ * \param created_node_run Where a pointer to the first node of the run is stored on success.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be created.
  */
-void print_singly_linked_list(SinglyLinkedList *singly_linked_list)
+static SinglyLinkedListStatus create_pooled_node_run(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count, Node **created_node_run)
 {
-  if (!is_valid_singly_linked_list(singly_linked_list))
+  if (node_data_array == NULL)
   {
-    printf("[ERROR] You cannot print a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'node_data_array' cannot be NULL.");
 
-    return;
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
   }
 
-  Node *current_node = singly_linked_list->head_node;
-
-  while (current_node != NULL)
+  for (size_t node_index = 0; node_index < node_count; node_index++)
   {
-    singly_linked_list->print_data_function(current_node->node_data);
+    if (node_data_array[node_index] == NULL)
+    {
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot create a new node with a NULL value.");
 
-    current_node = current_node->next_node;
+      return SINGLY_LINKED_LIST_ERROR_NULL_DATA;
+    }
   }
-}
 
-/**
- * \brief Frees all the nodes in the singly linked list and releases the memory.
- *
- * This function iterates through the singly linked list, starting from the head node, and frees
- * each node’s data using the `free_data_function` provided during the creation of the singly linked list.
- * After freeing the node’s data, it frees the memory allocated for the node itself. The function
- * continues until all nodes are freed. Afterward, it sets the `head_node` and `tail_node` of the
- * singly linked list to `NULL` to indicate that the list is empty.
- *
- * \param singly_linked_list A pointer to the `SinglyLinkedList` to be freed.
- */
-void free_singly_linked_list(SinglyLinkedList *singly_linked_list)
-{
-  if (!is_valid_singly_linked_list(singly_linked_list))
+  Node *node_run = allocate_node_run_from_pool(&singly_linked_list->node_pool, node_count);
+
+  if (node_run == NULL)
   {
-    printf("[ERROR] You cannot free a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'node_run'.");
 
-    return;
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
   }
 
-  Node *current_node = singly_linked_list->head_node;
-  Node *next_node = NULL;
-
-  while (current_node != NULL)
+  for (size_t node_index = 0; node_index < node_count; node_index++)
   {
-    next_node = current_node->next_node;
+    node_run[node_index].node_data = node_data_array[node_index];
+  }
 
-    singly_linked_list->free_data_function(current_node->node_data);
+  *created_node_run = node_run;
 
-    free(current_node);
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
 
-    current_node = next_node;
+/**
+ * \brief Adds a run of nodes that was just linked into the singly linked list to its hash index, if it has one.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` the nodes belong to.
+ * \param node_run A pointer to the first node of the run.
+ * \param node_count The number of nodes in the run.
+ */
+static void index_inserted_node_run(SinglyLinkedList *singly_linked_list, Node *node_run, size_t node_count)
+{
+  for (size_t node_index = 0; node_index < node_count && singly_linked_list->hash_index != NULL; node_index++)
+  {
+    index_inserted_node(singly_linked_list, &node_run[node_index]);
   }
+}
 
-  singly_linked_list->head_node = NULL;
-  singly_linked_list->tail_node = NULL;
+/**
+ * \brief Inserts an array of data at the head of the singly linked list in a single step.
+ *
+ * This function allocates the nodes for all the data as one contiguous block from the node pool of the list,
+ * links them in a single pass, and splices the resulting chain in front of the current head. The resulting
+ * order is the same as calling `insert_node_at_head` once per element of `node_data_array`, so the last
+ * element ends up at the head. If any element is `NULL`, nothing is inserted and an error is reported.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return true if all the nodes were inserted, false if an error occurred and none was inserted.
+ */
+bool insert_nodes_at_head_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count)
+{
+  return try_insert_nodes_at_head_bulk(singly_linked_list, node_data_array, node_count) == SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
- * \brief Returns the length of the singly linked list.
+ * \brief Inserts an array of data at the head of the singly linked list and reports the outcome as a status code.
  *
- * This function iterates through the singly linked list starting from the head node and counts
- * the number of nodes until it reaches the end of the list (i.e., when `current_node` becomes `NULL`).
- * It returns the total count of nodes in the list. If the list is empty (i.e., the `head_node` is `NULL`),
- * it returns 0.
+ * This function behaves like `insert_nodes_at_head_bulk`. On failure the list is left untouched.
  *
- * \param singly_linked_list A pointer to the `SinglyLinkedList` whose length is to be calculated.
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
  *
- * \return The number of nodes in the singly linked list.
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be inserted.
  */
-int get_linked_list_length(SinglyLinkedList *singly_linked_list)
+SinglyLinkedListStatus try_insert_nodes_at_head_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count)
 {
-  int number_of_nodes = 0;
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert nodes on a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
 
-  if (!is_valid_singly_linked_list(singly_linked_list) || singly_linked_list->head_node == NULL)
+  if (node_count == 0)
   {
-    return number_of_nodes;
+    return SINGLY_LINKED_LIST_SUCCESS;
   }
 
-  Node *current_node = singly_linked_list->head_node;
+  Node *node_run = NULL;
+  SinglyLinkedListStatus status = create_pooled_node_run(singly_linked_list, node_data_array, node_count, &node_run);
 
-  while (current_node != NULL)
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
   {
-    current_node = current_node->next_node;
+    return status;
+  }
+
+  node_run[0].next_node = singly_linked_list->head_node;
+
+  for (size_t node_index = 1; node_index < node_count; node_index++)
+  {
+    node_run[node_index].next_node = &node_run[node_index - 1];
+  }
 
-    number_of_nodes++;
+  if (singly_linked_list->head_node == NULL)
+  {
+    singly_linked_list->tail_node = &node_run[0];
   }
 
-  return number_of_nodes;
+  singly_linked_list->head_node = &node_run[node_count - 1];
+  singly_linked_list->length += node_count;
+
+  index_inserted_node_run(singly_linked_list, node_run, node_count);
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
- * \brief Reverses the order of elements in a singly linked list.
+ * \brief Inserts an array of data at the tail of the singly linked list in a single step.
  *
- * This function reverses the `next_node` pointers of each node in a singly linked list,
- * making the first node become the last, the second node become the second-to-last, and so on.
- * It also updates the `head_node` pointer of the singly linked list to point to the new first node after reversal.
+ * This function allocates the nodes for all the data as one contiguous block from the node pool of the list,
+ * links them in array order in a single pass, and splices the resulting chain after the current tail with a
+ * single tail update. If any element is `NULL`, nothing is inserted and an error is reported.
  *
- * \param singly_linked_list Pointer to the singly linked list to be reversed.
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return true if all the nodes were inserted, false if an error occurred and none was inserted.
  */
-void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
+bool insert_nodes_at_tail_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count)
+{
+  return try_insert_nodes_at_tail_bulk(singly_linked_list, node_data_array, node_count) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Inserts an array of data at the tail of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_nodes_at_tail_bulk`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` where the nodes will be inserted.
+ * \param node_data_array The data to be stored in the new nodes. None of the elements can be `NULL`.
+ * \param node_count The number of elements in `node_data_array`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_nodes_at_tail_bulk(SinglyLinkedList *singly_linked_list, NodeData *node_data_array, size_t node_count)
 {
   if (!is_valid_singly_linked_list(singly_linked_list))
   {
-    printf("[ERROR] You cannot reverse a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert nodes on a NULL singly linked list.");
 
-    return;
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
   }
 
+  if (node_count == 0)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  Node *node_run = NULL;
+  SinglyLinkedListStatus status = create_pooled_node_run(singly_linked_list, node_data_array, node_count, &node_run);
+
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
+  {
+    return status;
+  }
+
+  for (size_t node_index = 0; node_index + 1 < node_count; node_index++)
+  {
+    node_run[node_index].next_node = &node_run[node_index + 1];
+  }
+
+  node_run[node_count - 1].next_node = NULL;
+
   if (singly_linked_list->head_node == NULL)
   {
-    printf("[ERROR] You cannot reverse an empty singly linked list.\n");
+    singly_linked_list->head_node = &node_run[0];
+  }
+  else
+  {
+    singly_linked_list->tail_node->next_node = &node_run[0];
+  }
 
-    return;
+  singly_linked_list->tail_node = &node_run[node_count - 1];
+  singly_linked_list->length += node_count;
+
+  index_inserted_node_run(singly_linked_list, node_run, node_count);
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Prints all the nodes in the singly linked list.
+ *
+ * This function iterates through the entire singly linked list starting from the head node and
+ * prints the data stored in each node using the `print_data_function` provided during
+ * the creation of the singly linked list. The function continues until it reaches the end of the list,
+ * where the `next_node` is `NULL`.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be printed.
+ */
+void print_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  try_print_singly_linked_list(singly_linked_list);
+}
+
+/**
+ * \brief Prints all the nodes in the singly linked list and reports the outcome as a status code.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be printed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_print_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  Node *current_node = singly_linked_list->head_node;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+  while (current_node != NULL)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+
+    singly_linked_list->print_data_function(current_node->node_data);
+
+    current_node = current_node->next_node;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Frees all the nodes in the singly linked list and releases the memory.
+ *
+ * This function iterates through the singly linked list, starting from the head node, and frees
+ * each node’s data using the `free_data_function` provided during the creation of the singly linked list.
+ * Once the data of every node has been freed, all the slabs of the node pool of the list are returned
+ * at once instead of freeing the nodes one by one. An attached hash index or skip list index is detached and freed
+ * too. Afterward, it sets the `head_node` and `tail_node` of the singly linked list to `NULL` to indicate that the
+ * list is empty, so the list itself can be released with `free`.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be freed.
+ */
+void free_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  try_free_singly_linked_list(singly_linked_list);
+}
+
+/**
+ * \brief Frees all the nodes in the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `free_singly_linked_list`, including for attached indexes.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to be freed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_free_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  Node *current_node = singly_linked_list->head_node;
+  Node *next_node = NULL;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+  while (current_node != NULL)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+    next_node = current_node->next_node;
+
+    singly_linked_list->free_data_function(current_node->node_data);
+
+    current_node = next_node;
+  }
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+  destroy_node_pool(&singly_linked_list->node_pool);
+
+  detach_hash_index(singly_linked_list);
+  detach_skip_list_index(singly_linked_list);
+
+  singly_linked_list->head_node = NULL;
+  singly_linked_list->tail_node = NULL;
+  singly_linked_list->length = 0;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Returns the length of the singly linked list.
+ *
+ * This function returns the number of nodes tracked in the `length` field of the singly linked list,
+ * so it runs in constant time. If the list is empty or invalid, it returns 0. Lists holding more than
+ * `INT_MAX` nodes report `INT_MAX`; use `get_linked_list_size` to get the exact count.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose length is to be calculated.
+ *
+ * \return The number of nodes in the singly linked list, saturated to `INT_MAX`.
+ */
+int get_linked_list_length(SinglyLinkedList *singly_linked_list)
+{
+  size_t number_of_nodes = get_linked_list_size(singly_linked_list);
+
+  if (number_of_nodes > INT_MAX)
+  {
+    return INT_MAX;
+  }
+
+  return (int)number_of_nodes;
+}
+
+/**
+ * \brief Returns the exact number of nodes in the singly linked list.
+ *
+ * This function returns the `length` field of the singly linked list in constant time. Unlike
+ * `get_linked_list_length`, the count is a `size_t`, so lists holding more than `INT_MAX` nodes
+ * are reported exactly on 64-bit hosts. If the list is invalid, it returns 0.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` whose size is to be returned.
+ *
+ * \return The number of nodes in the singly linked list.
+ */
+size_t get_linked_list_size(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    return 0;
+  }
+
+  return singly_linked_list->length;
+}
+
+/**
+ * \brief Reverses the order of elements in a singly linked list.
+ *
+ * This function reverses the `next_node` pointers of each node in a singly linked list,
+ * making the first node become the last, the second node become the second-to-last, and so on.
+ * It also updates the `head_node` and `tail_node` pointers of the singly linked list to point to the new first and last nodes after reversal.
+ *
+ * \param singly_linked_list Pointer to the singly linked list to be reversed.
+ */
+void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  try_reverse_singly_linked_list(singly_linked_list);
+}
+
+/**
+ * \brief Reverses the order of elements in a singly linked list and reports the outcome as a status code.
+ *
+ * \param singly_linked_list Pointer to the singly linked list to be reversed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be reversed.
+ */
+SinglyLinkedListStatus try_reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list->head_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_EMPTY_LIST, "You cannot reverse an empty singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_EMPTY_LIST;
   }
 
   Node *previous_node = NULL;
@@ -313,7 +873,111 @@ void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
     current_node = next_node;
   }
 
+  singly_linked_list->tail_node = singly_linked_list->head_node;
   singly_linked_list->head_node = previous_node;
+
+  detach_skip_list_index(singly_linked_list);
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Searches the singly linked list for a batch of keys through a temporary hash set of the keys.
+ *
+ * Every key is wrapped in a node of a temporary array, and the nodes are indexed by a temporary `HashIndex`,
+ * with duplicate keys indexed once. Every node of the list is then looked up in the set, and the first node
+ * matching a key is stored for it. Keys equal to an indexed key get the node found for that key once the
+ * traversal is over.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` to search in.
+ * \param keys The data to search for.
+ * \param key_count The number of keys in `keys`.
+ * \param found_nodes Where the node matching every key is stored. Every entry must be `NULL` on entry.
+ * \param hash_data_function A function pointer used to hash keys and node data.
+ * \param matched_keys_count Where the number of keys for which a matching node was found is stored.
+ *
+ * \return true if the keys were searched, false if the hash set could not be allocated and nothing was done.
+ */
+static bool find_nodes_by_data_with_key_set(SinglyLinkedList *singly_linked_list, NodeData *keys, size_t key_count, Node **found_nodes, HashDataFunction hash_data_function, size_t *matched_keys_count)
+{
+  if (key_count > SIZE_MAX / sizeof(Node))
+  {
+    return false;
+  }
+
+  HashIndex *key_set = create_hash_index(hash_data_function, singly_linked_list->compare_data_function);
+  Node *key_nodes = (Node *)malloc(key_count * sizeof(Node));
+
+  if (key_set == NULL || key_nodes == NULL)
+  {
+    if (key_set != NULL)
+    {
+      free_hash_index(key_set);
+    }
+
+    free(key_nodes);
+
+    return false;
+  }
+
+  size_t distinct_keys_count = 0;
+
+  for (size_t key_index = 0; key_index < key_count; key_index++)
+  {
+    key_nodes[key_index].node_data = keys[key_index];
+    key_nodes[key_index].next_node = NULL;
+
+    if (find_node_in_hash_index(key_set, keys[key_index]) != NULL)
+    {
+      continue;
+    }
+
+    if (!insert_node_into_hash_index(key_set, &key_nodes[key_index]))
+    {
+      free_hash_index(key_set);
+      free(key_nodes);
+
+      return false;
+    }
+
+    distinct_keys_count++;
+  }
+
+  size_t found_distinct_keys_count = 0;
+  Node *current_node = singly_linked_list->head_node;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+  while (current_node != NULL && found_distinct_keys_count < distinct_keys_count)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+
+    Node *key_node = find_node_in_hash_index(key_set, current_node->node_data);
+
+    if (key_node != NULL && found_nodes[key_node - key_nodes] == NULL)
+    {
+      found_nodes[key_node - key_nodes] = current_node;
+
+      found_distinct_keys_count++;
+    }
+
+    current_node = current_node->next_node;
+  }
+
+  for (size_t key_index = 0; key_index < key_count; key_index++)
+  {
+    found_nodes[key_index] = found_nodes[find_node_in_hash_index(key_set, keys[key_index]) - key_nodes];
+
+    if (found_nodes[key_index] != NULL)
+    {
+      (*matched_keys_count)++;
+    }
+  }
+
+  free_hash_index(key_set);
+  free(key_nodes);
+
+  return true;
 }
 
 /**
@@ -322,6 +986,8 @@ void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
  * This function iterates through the singly linked list and compares the data of each node
  * with the provided `node_data`. If a node with matching data is found, the function
  * returns a pointer to that node. If no match is found or the list is empty, it returns `NULL`.
+ * If a hash index is attached to the list, the node is looked up in the index instead of scanning the
+ * list; when several nodes match, any one of them may be returned.
  *
  * \param singly_linked_list A pointer to the singly linked list to search in.
  * \param node_data The data to search for in the singly linked list.
@@ -330,74 +996,279 @@ void reverse_singly_linked_list(SinglyLinkedList *singly_linked_list)
  */
 Node *find_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data)
 {
+  Node *found_node = NULL;
+
+  try_find_node_by_data(singly_linked_list, node_data, &found_node);
+
+  return found_node;
+}
+
+/**
+ * \brief Searches for a node in the singly linked list by its data and reports the outcome as a status code.
+ *
+ * This function behaves like `find_node_by_data`. Not finding a matching node is not an error: the function
+ * succeeds and stores `NULL` in `found_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ * \param found_node Where the matching node, or `NULL` if there is none, is stored.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_find_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data, Node **found_node)
+{
+  if (found_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'found_node' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  *found_node = NULL;
+
   if (!is_valid_singly_linked_list(singly_linked_list))
   {
-    printf("[ERROR] You cannot insert a node on a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for a node in a NULL singly linked list.");
 
-    return NULL;
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    *found_node = find_node_in_hash_index(singly_linked_list->hash_index, node_data);
+
+    return SINGLY_LINKED_LIST_SUCCESS;
   }
 
   Node *current_node = singly_linked_list->head_node;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
 
   while (current_node != NULL)
   {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+
     if (singly_linked_list->compare_data_function(current_node->node_data, node_data))
     {
-      return current_node;
+      *found_node = current_node;
+
+      return SINGLY_LINKED_LIST_SUCCESS;
     }
 
     current_node = current_node->next_node;
   }
 
-  return NULL;
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
 
 /**
- * \brief Checks if a singly linked list is valid.
+ * \brief Searches the singly linked list for a batch of keys in a single traversal.
  *
- * This function checks whether the provided singly linked list pointer is not NULL.
- * It is a simple validation function to ensure the singly linked list is properly
- * allocated before performing any further operations on it.
+ * For every key, `found_nodes` receives the first node whose data matches it, or `NULL` if there is none, like
+ * `key_count` calls to `find_node_by_data` would, but the list is traversed once instead of once per key. Batches
+ * of up to `FIND_NODES_BATCH_LINEAR_KEY_LIMIT` keys, or any batch if `hash_data_function` is `NULL`, are compared
+ * against every node one key at a time. Larger batches are put in a temporary hash set built with
+ * `hash_data_function`, which must hash keys and node data alike, so the traversal costs O(n + k) instead of
+ * O(n * k). The hash set calls the compare function of the list with a key as its first argument, so the compare
+ * function must be symmetric, as it must be for a hash index. If the hash set cannot be allocated, the keys are
+ * compared one by one instead. The traversal stops as soon as every key has been found. If a hash index is attached to the list, every key is looked up in it
+ * instead and, when several nodes match, any one of them may be returned.
  *
- * \param singly_linked_list A pointer to the singly linked list to be checked.
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param keys The data to search for. This can be `NULL` only if `key_count` is 0.
+ * \param key_count The number of keys in `keys`.
+ * \param found_nodes Where the node matching every key, or `NULL`, is stored. It must hold `key_count` pointers.
+ * \param hash_data_function A function pointer used to hash the keys of large batches, or `NULL`.
  *
- * \return true if the singly linked list is not NULL, false otherwise.
+ * \return The number of keys for which a matching node was found.
  */
-bool is_valid_singly_linked_list(SinglyLinkedList *singly_linked_list)
+size_t find_nodes_by_data_batch(SinglyLinkedList *singly_linked_list, NodeData *keys, size_t key_count, Node **found_nodes, HashDataFunction hash_data_function)
 {
-  return singly_linked_list != NULL;
+  size_t found_keys_count = 0;
+
+  try_find_nodes_by_data_batch(singly_linked_list, keys, key_count, found_nodes, hash_data_function, &found_keys_count);
+
+  return found_keys_count;
 }
 
 /**
- * \brief Deletes nodes from the singly linked list that match the provided data.
+ * \brief Searches the singly linked list for a batch of keys in a single traversal and reports the outcome as a status code.
  *
- * This function iterates through the singly linked list, comparing the data of each node
- * with the provided `node_data`. If a node with matching data is found, the node is deleted,
- * and its memory is freed. The list is updated accordingly, and the head and tail pointers
- * are adjusted if necessary. The function will remove all matching nodes, and the number of
- * deleted nodes is returned.
+ * This function behaves like `find_nodes_by_data_batch`. Not finding a key is not an error: the function succeeds
+ * and stores `NULL` for it in `found_nodes`.
  *
- * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
- * \param node_data The data to search for in the singly linked list. Nodes with matching data will be deleted.
+ * \param singly_linked_list A pointer to the singly linked list to search in.
+ * \param keys The data to search for. This can be `NULL` only if `key_count` is 0.
+ * \param key_count The number of keys in `keys`.
+ * \param found_nodes Where the node matching every key, or `NULL`, is stored. It must hold `key_count` pointers.
+ * \param hash_data_function A function pointer used to hash the keys of large batches, or `NULL`.
+ * \param found_keys_count Where the number of keys for which a matching node was found is stored. This can be `NULL`.
  *
- * \return The number of nodes that were deleted from the list.
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
  */
-int delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data)
+SinglyLinkedListStatus try_find_nodes_by_data_batch(SinglyLinkedList *singly_linked_list, NodeData *keys, size_t key_count, Node **found_nodes, HashDataFunction hash_data_function, size_t *found_keys_count)
 {
-  int deleted_nodes_count = 0;
+  if (found_keys_count != NULL)
+  {
+    *found_keys_count = 0;
+  }
 
   if (!is_valid_singly_linked_list(singly_linked_list))
   {
-    printf("[ERROR] You cannot delete a node on a NULL singly linked list.\n");
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for nodes in a NULL singly linked list.");
 
-    return deleted_nodes_count;
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
   }
 
-  Node *current_node = singly_linked_list->head_node;
-  Node *previous_node = NULL;
-
-  while (current_node != NULL)
+  if (key_count == 0)
   {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  if (keys == NULL || found_nodes == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'keys' and 'found_nodes' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  size_t matched_keys_count = 0;
+
+  for (size_t key_index = 0; key_index < key_count; key_index++)
+  {
+    found_nodes[key_index] = NULL;
+  }
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    for (size_t key_index = 0; key_index < key_count; key_index++)
+    {
+      found_nodes[key_index] = find_node_in_hash_index(singly_linked_list->hash_index, keys[key_index]);
+
+      if (found_nodes[key_index] != NULL)
+      {
+        matched_keys_count++;
+      }
+    }
+  }
+  else if (key_count <= FIND_NODES_BATCH_LINEAR_KEY_LIMIT || hash_data_function == NULL || !find_nodes_by_data_with_key_set(singly_linked_list, keys, key_count, found_nodes, hash_data_function, &matched_keys_count))
+  {
+    Node *current_node = singly_linked_list->head_node;
+    Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+    while (current_node != NULL && matched_keys_count < key_count)
+    {
+      lookahead_node = advance_lookahead_node(lookahead_node);
+
+      for (size_t key_index = 0; key_index < key_count; key_index++)
+      {
+        if (found_nodes[key_index] == NULL && singly_linked_list->compare_data_function(current_node->node_data, keys[key_index]))
+        {
+          found_nodes[key_index] = current_node;
+
+          matched_keys_count++;
+        }
+      }
+
+      current_node = current_node->next_node;
+    }
+  }
+
+  if (found_keys_count != NULL)
+  {
+    *found_keys_count = matched_keys_count;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Checks if a singly linked list is valid.
+ *
+ * This function checks whether the provided singly linked list pointer is not NULL.
+ * It is a simple validation function to ensure the singly linked list is properly
+ * allocated before performing any further operations on it.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be checked.
+ *
+ * \return true if the singly linked list is not NULL, false otherwise.
+ */
+bool is_valid_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  return singly_linked_list != NULL;
+}
+
+/**
+ * \brief Deletes nodes from the singly linked list that match the provided data.
+ *
+ * This function iterates through the singly linked list, comparing the data of each node
+ * with the provided `node_data`. If a node with matching data is found, the node is deleted,
+ * its data is freed and the node is returned to the node pool of the list. The list is updated accordingly, and the head and tail pointers
+ * are adjusted if necessary. The function will remove all matching nodes, and the number of
+ * deleted nodes is returned. If a hash index is attached to the list, it is used to count the matching
+ * nodes first, so the function returns immediately when there is none and stops scanning as soon as the
+ * last one has been deleted.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list. Nodes with matching data will be deleted.
+ *
+ * \return The number of nodes that were deleted from the list, saturated to `INT_MAX`.
+ */
+int delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  size_t deleted_nodes_count = 0;
+
+  try_delete_node_by_data(singly_linked_list, node_data, &deleted_nodes_count);
+
+  if (deleted_nodes_count > INT_MAX)
+  {
+    return INT_MAX;
+  }
+
+  return (int)deleted_nodes_count;
+}
+
+/**
+ * \brief Deletes nodes from the singly linked list that match the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_node_by_data`, but stores the exact number of deleted nodes.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list. Nodes with matching data will be deleted.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or `SINGLY_LINKED_LIST_ERROR_NULL_LIST` if the list is `NULL`.
+ */
+SinglyLinkedListStatus try_delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data, size_t *deleted_nodes_count)
+{
+  size_t deleted_count = 0;
+
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = 0;
+  }
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node on a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  size_t remaining_matches_count = SIZE_MAX;
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    remaining_matches_count = count_nodes_in_hash_index(singly_linked_list->hash_index, node_data);
+  }
+
+  Node *current_node = singly_linked_list->head_node;
+  Node *previous_node = NULL;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+  while (current_node != NULL && remaining_matches_count > 0)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+
     if (singly_linked_list->compare_data_function(current_node->node_data, node_data))
     {
       Node *node_to_delete = current_node;
@@ -423,11 +1294,25 @@ int delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data
 
       current_node = current_node->next_node;
 
+      if (singly_linked_list->hash_index != NULL)
+      {
+        remove_node_from_hash_index(singly_linked_list->hash_index, node_to_delete);
+
+        remaining_matches_count--;
+      }
+
+      if (singly_linked_list->skip_list_index != NULL)
+      {
+        remove_node_from_skip_list_index(singly_linked_list->skip_list_index, node_to_delete);
+      }
+
       singly_linked_list->free_data_function(node_to_delete->node_data);
 
-      free(node_to_delete);
+      release_unlinked_node(singly_linked_list, node_to_delete, previous_node);
+
+      singly_linked_list->length--;
 
-      deleted_nodes_count++;
+      deleted_count++;
     }
     else
     {
@@ -436,5 +1321,1041 @@ int delete_node_by_data(SinglyLinkedList *singly_linked_list, NodeData node_data
     }
   }
 
-  return deleted_nodes_count;
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = deleted_count;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Frees the data of a chain of nodes deleted from the singly linked list, in chain order.
+ *
+ * The data is gathered into batches of up to `DELETE_NODES_FREE_BATCH_SIZE` entries for the `free_data_batch_function`
+ * of the list if it has one, and passed to its `free_data_function` one node at a time otherwise.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` the nodes were deleted from.
+ * \param victims_head A pointer to the first node of the chain, which ends with a `NULL` `next_node`.
+ */
+static void free_victim_chain_data(SinglyLinkedList *singly_linked_list, Node *victims_head)
+{
+  if (singly_linked_list->free_data_batch_function == NULL)
+  {
+    for (Node *victim_node = victims_head; victim_node != NULL; victim_node = victim_node->next_node)
+    {
+      singly_linked_list->free_data_function(victim_node->node_data);
+    }
+
+    return;
+  }
+
+  NodeData data_batch[DELETE_NODES_FREE_BATCH_SIZE];
+  size_t batch_count = 0;
+
+  for (Node *victim_node = victims_head; victim_node != NULL; victim_node = victim_node->next_node)
+  {
+    data_batch[batch_count++] = victim_node->node_data;
+
+    if (batch_count == DELETE_NODES_FREE_BATCH_SIZE)
+    {
+      singly_linked_list->free_data_batch_function(data_batch, batch_count);
+
+      batch_count = 0;
+    }
+  }
+
+  if (batch_count > 0)
+  {
+    singly_linked_list->free_data_batch_function(data_batch, batch_count);
+  }
+}
+
+/**
+ * \brief Deletes every node of the singly linked list whose data satisfies a predicate, in a single pass.
+ *
+ * This function calls `predicate_function` on the data of every node, from head to tail, with the provided
+ * `context`. Matching nodes are unlinked and gathered into a chain of victims while the attached indexes are
+ * updated, so the list is traversed once whatever the number of matches. Their data is then freed, in list order,
+ * through the `free_data_batch_function` of the list in batches of up to `DELETE_NODES_FREE_BATCH_SIZE` entries,
+ * or through its `free_data_function` one node at a time if it has no batch free function. Finally, the whole
+ * chain is returned to the node pool of the list at once. The predicate must not modify the list.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param predicate_function A function pointer used to decide which nodes are deleted. This cannot be `NULL`.
+ * \param context A pointer passed to every call of `predicate_function`. This can be `NULL`.
+ *
+ * \return The number of nodes that were deleted from the list.
+ */
+size_t delete_nodes_if(SinglyLinkedList *singly_linked_list, NodePredicateFunction predicate_function, void *context)
+{
+  size_t deleted_count = 0;
+
+  try_delete_nodes_if(singly_linked_list, predicate_function, context, &deleted_count);
+
+  return deleted_count;
+}
+
+/**
+ * \brief Deletes every node of the singly linked list whose data satisfies a predicate and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_nodes_if`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list from which nodes will be deleted.
+ * \param predicate_function A function pointer used to decide which nodes are deleted. This cannot be `NULL`.
+ * \param context A pointer passed to every call of `predicate_function`. This can be `NULL`.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be deleted.
+ */
+SinglyLinkedListStatus try_delete_nodes_if(SinglyLinkedList *singly_linked_list, NodePredicateFunction predicate_function, void *context, size_t *deleted_nodes_count)
+{
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = 0;
+  }
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete nodes from a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (predicate_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'predicate_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  Node *victims_head = NULL;
+  Node *victims_tail = NULL;
+  size_t deleted_count = 0;
+  Node *current_node = singly_linked_list->head_node;
+  Node *previous_node = NULL;
+  Node *lookahead_node = start_lookahead_node(singly_linked_list, current_node);
+
+  while (current_node != NULL)
+  {
+    lookahead_node = advance_lookahead_node(lookahead_node);
+
+    Node *next_node = current_node->next_node;
+
+    if (!predicate_function(current_node->node_data, context))
+    {
+      previous_node = current_node;
+      current_node = next_node;
+
+      continue;
+    }
+
+    if (previous_node == NULL)
+    {
+      singly_linked_list->head_node = next_node;
+    }
+    else
+    {
+      previous_node->next_node = next_node;
+    }
+
+    if (singly_linked_list->hash_index != NULL)
+    {
+      remove_node_from_hash_index(singly_linked_list->hash_index, current_node);
+    }
+
+    if (singly_linked_list->skip_list_index != NULL)
+    {
+      remove_node_from_skip_list_index(singly_linked_list->skip_list_index, current_node);
+    }
+
+    if (singly_linked_list->last_compacted_node == current_node)
+    {
+      singly_linked_list->last_compacted_node = previous_node;
+    }
+
+    if (singly_linked_list->compaction_end_node == current_node)
+    {
+      singly_linked_list->compaction_end_node = previous_node;
+    }
+
+    current_node->next_node = NULL;
+
+    if (victims_tail == NULL)
+    {
+      victims_head = current_node;
+    }
+    else
+    {
+      victims_tail->next_node = current_node;
+    }
+
+    victims_tail = current_node;
+    current_node = next_node;
+
+    deleted_count++;
+  }
+
+  if (deleted_count == 0)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  singly_linked_list->tail_node = previous_node;
+  singly_linked_list->length -= deleted_count;
+
+  free_victim_chain_data(singly_linked_list, victims_head);
+
+  release_node_chain_to_pool(singly_linked_list->is_compacting ? &singly_linked_list->compaction_source_pool : &singly_linked_list->node_pool, victims_head, victims_tail);
+
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = deleted_count;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Moves every node of the source singly linked list to the tail of the destination one, in constant time.
+ *
+ * This function links the tail of the destination list to the head of the source list and leaves the source list
+ * empty but valid, like `splice_singly_linked_list_after_node` after the tail of the destination list.
+ *
+ * \param destination_singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param source_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the destination list.
+ *
+ * \return true if the nodes were moved, false if an error occurred and both lists were left untouched.
+ */
+bool concatenate_singly_linked_lists(SinglyLinkedList *destination_singly_linked_list, SinglyLinkedList *source_singly_linked_list)
+{
+  return try_concatenate_singly_linked_lists(destination_singly_linked_list, source_singly_linked_list) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Moves every node of the source singly linked list to the tail of the destination one and reports the outcome as a status code.
+ *
+ * This function behaves like `concatenate_singly_linked_lists`.
+ *
+ * \param destination_singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param source_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the destination list.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_concatenate_singly_linked_lists(SinglyLinkedList *destination_singly_linked_list, SinglyLinkedList *source_singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(destination_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot concatenate to a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  return try_splice_singly_linked_list_after_node(destination_singly_linked_list, destination_singly_linked_list->tail_node, source_singly_linked_list);
+}
+
+/**
+ * \brief Moves every node of another singly linked list after a node of the singly linked list, in constant time.
+ *
+ * The chain of `other_singly_linked_list` is linked between `node` and its successor without allocating, copying
+ * or freeing anything, and the other list is left empty but valid. The slabs of its node pool are handed over to
+ * the pool of the list, so the moved nodes are freed with the list and their data with its `free_data_function`.
+ * If the list has a hash index, the moved nodes are added to it, which takes time proportional to their number.
+ * Any skip list index attached to the list is detached, and the indexes of the other list are emptied. Incremental
+ * compactions in progress on either list are canceled.
+ *
+ * \param singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param node A pointer to a node of the list after which the nodes are linked, or `NULL` to link them at the head.
+ * \param other_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the list.
+ *
+ * \return true if the nodes were moved, false if an error occurred and both lists were left untouched.
+ */
+bool splice_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList *other_singly_linked_list)
+{
+  return try_splice_singly_linked_list_after_node(singly_linked_list, node, other_singly_linked_list) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Moves every node of another singly linked list after a node of the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `splice_singly_linked_list_after_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list receiving the nodes.
+ * \param node A pointer to a node of the list after which the nodes are linked, or `NULL` to link them at the head.
+ * \param other_singly_linked_list A pointer to the singly linked list whose nodes are moved. It must not be the list.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_splice_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList *other_singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list) || !is_valid_singly_linked_list(other_singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot splice a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list == other_singly_linked_list)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT, "You cannot splice a singly linked list into itself.");
+
+    return SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (other_singly_linked_list->head_node == NULL)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+  cancel_singly_linked_list_compaction(other_singly_linked_list);
+
+  Node *first_moved_node = other_singly_linked_list->head_node;
+  Node *last_moved_node = other_singly_linked_list->tail_node;
+
+  if (node == NULL)
+  {
+    last_moved_node->next_node = singly_linked_list->head_node;
+    singly_linked_list->head_node = first_moved_node;
+  }
+  else
+  {
+    last_moved_node->next_node = node->next_node;
+    node->next_node = first_moved_node;
+  }
+
+  if (singly_linked_list->tail_node == node)
+  {
+    singly_linked_list->tail_node = last_moved_node;
+  }
+
+  singly_linked_list->length += other_singly_linked_list->length;
+
+  merge_node_pools(&singly_linked_list->node_pool, &other_singly_linked_list->node_pool);
+
+  other_singly_linked_list->head_node = NULL;
+  other_singly_linked_list->tail_node = NULL;
+  other_singly_linked_list->length = 0;
+
+  if (other_singly_linked_list->hash_index != NULL)
+  {
+    clear_hash_index(other_singly_linked_list->hash_index);
+  }
+
+  if (other_singly_linked_list->skip_list_index != NULL)
+  {
+    clear_skip_list_index(other_singly_linked_list->skip_list_index);
+  }
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    for (Node *moved_node = first_moved_node; moved_node != last_moved_node->next_node; moved_node = moved_node->next_node)
+    {
+      index_inserted_node(singly_linked_list, moved_node);
+
+      if (singly_linked_list->hash_index == NULL)
+      {
+        break;
+      }
+    }
+  }
+
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Cuts the singly linked list after a node, moving the nodes that follow it to a new list.
+ *
+ * The chain is cut without allocating, copying or freeing any node: the new list is created with the function
+ * pointers, order function, batch free function and prefetch distance of the list, and takes over the nodes after
+ * `node`. The node pools of both lists join a sharing group, so each list can free its own nodes while the slabs
+ * they live in are kept until both lists have been freed. Counting the moved nodes walks the shorter of the two
+ * parts, or the moved part if the list has a hash index, since the moved nodes are removed from it. Any skip list
+ * index attached to the list is detached, and any incremental compaction in progress is canceled. Both lists must
+ * be freed with `free_singly_linked_list` before their structures are released.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be cut.
+ * \param node A pointer to the last node of the list to be kept, or `NULL` to move every node.
+ *
+ * \return A pointer to the new list holding the nodes after `node`, or `NULL` if an error occurred and the list was left untouched.
+ */
+SinglyLinkedList *split_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node)
+{
+  SinglyLinkedList *split_singly_linked_list = NULL;
+
+  try_split_singly_linked_list_after_node(singly_linked_list, node, &split_singly_linked_list);
+
+  return split_singly_linked_list;
+}
+
+/**
+ * \brief Cuts the singly linked list after a node and reports the outcome as a status code.
+ *
+ * This function behaves like `split_singly_linked_list_after_node`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be cut.
+ * \param node A pointer to the last node of the list to be kept, or `NULL` to move every node.
+ * \param split_singly_linked_list Where the new list holding the nodes after `node` is stored on success.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be cut.
+ */
+SinglyLinkedListStatus try_split_singly_linked_list_after_node(SinglyLinkedList *singly_linked_list, Node *node, SinglyLinkedList **split_singly_linked_list)
+{
+  if (split_singly_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'split_singly_linked_list' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  *split_singly_linked_list = NULL;
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot split a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  SinglyLinkedList *new_singly_linked_list = NULL;
+  SinglyLinkedListStatus status = try_create_singly_linked_list(singly_linked_list->print_data_function, singly_linked_list->free_data_function, singly_linked_list->compare_data_function, &new_singly_linked_list);
+
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
+  {
+    return status;
+  }
+
+  new_singly_linked_list->order_data_function = singly_linked_list->order_data_function;
+  new_singly_linked_list->free_data_batch_function = singly_linked_list->free_data_batch_function;
+  new_singly_linked_list->prefetch_distance = singly_linked_list->prefetch_distance;
+
+  *split_singly_linked_list = new_singly_linked_list;
+
+  Node *first_moved_node = node == NULL ? singly_linked_list->head_node : node->next_node;
+
+  if (first_moved_node == NULL)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  size_t moved_nodes_count = 0;
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    for (Node *moved_node = first_moved_node; moved_node != NULL; moved_node = moved_node->next_node)
+    {
+      remove_node_from_hash_index(singly_linked_list->hash_index, moved_node);
+
+      moved_nodes_count++;
+    }
+  }
+  else
+  {
+    Node *kept_node = singly_linked_list->head_node;
+    Node *moved_node = first_moved_node;
+    size_t walked_nodes_count = 0;
+
+    while (moved_node != NULL && kept_node != first_moved_node)
+    {
+      kept_node = kept_node->next_node;
+      moved_node = moved_node->next_node;
+
+      walked_nodes_count++;
+    }
+
+    moved_nodes_count = moved_node == NULL ? walked_nodes_count : singly_linked_list->length - walked_nodes_count;
+  }
+
+  new_singly_linked_list->head_node = first_moved_node;
+  new_singly_linked_list->tail_node = singly_linked_list->tail_node;
+  new_singly_linked_list->length = moved_nodes_count;
+
+  if (node == NULL)
+  {
+    singly_linked_list->head_node = NULL;
+  }
+  else
+  {
+    node->next_node = NULL;
+  }
+
+  singly_linked_list->tail_node = node;
+  singly_linked_list->length -= moved_nodes_count;
+
+  share_node_pools(&singly_linked_list->node_pool, &new_singly_linked_list->node_pool);
+  detach_skip_list_index(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Attaches a hash index to the singly linked list.
+ *
+ * This function creates a hash index using the provided `hash_data_function` and the compare function of
+ * the list, and indexes every node already in the list. From then on, every insertion and deletion keeps
+ * the index in sync, and `find_node_by_data` and `delete_node_by_data` use it. Any index previously
+ * attached to the list is replaced.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ *
+ * \return true if the index was attached, false if an error occurred.
+ */
+bool attach_hash_index(SinglyLinkedList *singly_linked_list, HashDataFunction hash_data_function)
+{
+  return try_attach_hash_index(singly_linked_list, hash_data_function) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Attaches a hash index to the singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `attach_hash_index`. On failure any previously attached index is kept.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ * \param hash_data_function A function pointer used to hash node data. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the index could not be attached.
+ */
+SinglyLinkedListStatus try_attach_hash_index(SinglyLinkedList *singly_linked_list, HashDataFunction hash_data_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot attach a hash index to a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (hash_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'hash_data_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  HashIndex *hash_index = create_hash_index(hash_data_function, singly_linked_list->compare_data_function);
+
+  if (hash_index == NULL)
+  {
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  Node *current_node = singly_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    if (!insert_node_into_hash_index(hash_index, current_node))
+    {
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "An error occurred while indexing the singly linked list.");
+
+      free_hash_index(hash_index);
+
+      return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+    }
+
+    current_node = current_node->next_node;
+  }
+
+  detach_hash_index(singly_linked_list);
+
+  singly_linked_list->hash_index = hash_index;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sets the function used to order the data of the singly linked list.
+ *
+ * The order function is used by the sort functions of the list. It can be changed or removed at any time
+ * by passing another function or `NULL`. Since the list may not be sorted by the new function, any attached
+ * skip list index is detached.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose order function will be set.
+ * \param order_data_function A function pointer used to order node data, or `NULL`.
+ */
+void set_order_data_function(SinglyLinkedList *singly_linked_list, OrderDataFunction order_data_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot set the order function of a NULL singly linked list.");
+
+    return;
+  }
+
+  singly_linked_list->order_data_function = order_data_function;
+
+  detach_skip_list_index(singly_linked_list);
+}
+
+/**
+ * \brief Sets the function used to free the data of several nodes of the singly linked list at once.
+ *
+ * The batch free function is used by `delete_nodes_if` instead of calling the `free_data_function` of the list
+ * on every deleted node. It can be changed or removed at any time by passing another function or `NULL`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose batch free function will be set.
+ * \param free_data_batch_function A function pointer used to free the data of several nodes at once, or `NULL`.
+ */
+void set_free_data_batch_function(SinglyLinkedList *singly_linked_list, FreeDataBatchFunction free_data_batch_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot set the batch free function of a NULL singly linked list.");
+
+    return;
+  }
+
+  singly_linked_list->free_data_batch_function = free_data_batch_function;
+}
+
+/**
+ * \brief Sets how many nodes ahead of the current one the traversals of the singly linked list prefetch.
+ *
+ * The linear scans of `find_node_by_data`, `delete_node_by_data`, `print_singly_linked_list` and
+ * `free_singly_linked_list` prefetch the node `prefetch_distance` positions ahead and its data while they
+ * visit the current node. Larger distances hide more latency on lists scattered in memory, as long as the
+ * prefetched lines are not evicted before they are reached. Lists start with
+ * `SINGLY_LINKED_LIST_DEFAULT_PREFETCH_DISTANCE`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose prefetch distance will be set.
+ * \param prefetch_distance The number of nodes to prefetch ahead, or 0 to disable prefetching.
+ */
+void set_prefetch_distance(SinglyLinkedList *singly_linked_list, size_t prefetch_distance)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot set the prefetch distance of a NULL singly linked list.");
+
+    return;
+  }
+
+  singly_linked_list->prefetch_distance = prefetch_distance;
+}
+
+/**
+ * \brief Detaches and frees the hash index of the singly linked list, if it has one.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose index will be removed.
+ */
+void detach_hash_index(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot detach a hash index from a NULL singly linked list.");
+
+    return;
+  }
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    free_hash_index(singly_linked_list->hash_index);
+
+    singly_linked_list->hash_index = NULL;
+  }
+}
+
+/**
+ * \brief Attaches a skip list index to the sorted singly linked list.
+ *
+ * This function checks that the list is sorted by its `order_data_function` and builds express lanes over its
+ * `next_node` chain in a single pass. From then on, `insert_node_into_sorted_list`, `find_node_in_sorted_list` and
+ * `delete_node_from_sorted_list` run in expected O(log n) time, and `delete_node_by_data` keeps the index in sync.
+ * The nodes are not moved or relinked, so the list can still be traversed and printed as before. Inserting at the
+ * head or tail, bulk inserting, reversing, radix sorting and changing the order function can break the order of the
+ * list, so they detach the index. Any index previously attached to the list is replaced.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ *
+ * \return true if the index was attached, false if an error occurred.
+ */
+bool attach_skip_list_index(SinglyLinkedList *singly_linked_list)
+{
+  return try_attach_skip_list_index(singly_linked_list) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Attaches a skip list index to the sorted singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `attach_skip_list_index`. On failure any previously attached index is kept.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be indexed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, `SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT` if the list has no order function,
+ * `SINGLY_LINKED_LIST_ERROR_NOT_SORTED` if the list is not sorted by it, or the reason the index could not be attached.
+ */
+SinglyLinkedListStatus try_attach_skip_list_index(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot attach a skip list index to a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  OrderDataFunction order_data_function = singly_linked_list->order_data_function;
+
+  if (order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot attach a skip list index to a singly linked list without an order function.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL && current_node->next_node != NULL; current_node = current_node->next_node)
+  {
+    if (order_data_function(current_node->node_data, current_node->next_node->node_data) > 0)
+    {
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NOT_SORTED, "You cannot attach a skip list index to an unsorted singly linked list.");
+
+      return SINGLY_LINKED_LIST_ERROR_NOT_SORTED;
+    }
+  }
+
+  SkipListIndex *skip_list_index = create_skip_list_index(order_data_function);
+
+  if (skip_list_index == NULL)
+  {
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  if (!build_skip_list_index(skip_list_index, singly_linked_list->head_node))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "An error occurred while indexing the singly linked list.");
+
+    free_skip_list_index(skip_list_index);
+
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  detach_skip_list_index(singly_linked_list);
+
+  singly_linked_list->skip_list_index = skip_list_index;
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Detaches and frees the skip list index of the singly linked list, if it has one.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose index will be removed.
+ */
+void detach_skip_list_index(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot detach a skip list index from a NULL singly linked list.");
+
+    return;
+  }
+
+  if (singly_linked_list->skip_list_index != NULL)
+  {
+    free_skip_list_index(singly_linked_list->skip_list_index);
+
+    singly_linked_list->skip_list_index = NULL;
+  }
+}
+
+/**
+ * \brief Finds the last node of the sorted singly linked list that goes before the provided data.
+ *
+ * The search starts from the node found through the skip list index, if the list has one, and from the head
+ * of the list otherwise, and then follows the `next_node` chain.
+ *
+ * \param singly_linked_list A pointer to the sorted `SinglyLinkedList` to search in.
+ * \param node_data The data to search for.
+ * \param include_equivalent Whether nodes whose data is equivalent to `node_data` also count as going before it.
+ *
+ * \return A pointer to the node, or `NULL` if no node goes before the data.
+ */
+static Node *find_predecessor_in_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data, bool include_equivalent)
+{
+  Node *predecessor_node = NULL;
+
+  if (singly_linked_list->skip_list_index != NULL)
+  {
+    predecessor_node = find_predecessor_in_skip_list_index(singly_linked_list->skip_list_index, node_data, include_equivalent);
+  }
+
+  Node *current_node = predecessor_node == NULL ? singly_linked_list->head_node : predecessor_node->next_node;
+
+  while (current_node != NULL)
+  {
+    int order = singly_linked_list->order_data_function(current_node->node_data, node_data);
+
+    if (order > 0 || (order == 0 && !include_equivalent))
+    {
+      break;
+    }
+
+    predecessor_node = current_node;
+    current_node = current_node->next_node;
+  }
+
+  return predecessor_node;
+}
+
+/**
+ * \brief Inserts a new node into the sorted singly linked list, keeping it sorted.
+ *
+ * This function links the new node after every node whose data goes before or is equivalent to `node_data`
+ * according to the `order_data_function` of the list, so insertions are stable. With a skip list index attached,
+ * the position is found in expected O(log n) time and the node is added to the index; otherwise the list is
+ * scanned from its head. If the index cannot be updated, it is detached and an error is reported, but the node
+ * stays in the list.
+ *
+ * \param singly_linked_list A pointer to the sorted `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ */
+void insert_node_into_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  try_insert_node_into_sorted_list(singly_linked_list, node_data);
+}
+
+/**
+ * \brief Inserts a new node into the sorted singly linked list and reports the outcome as a status code.
+ *
+ * This function behaves like `insert_node_into_sorted_list`. On failure the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the sorted `SinglyLinkedList` where the node will be inserted.
+ * \param node_data The data to be stored in the new node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the node could not be inserted.
+ */
+SinglyLinkedListStatus try_insert_node_into_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert a node on a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list->order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot insert a node in order in a singly linked list without an order function.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  Node *new_node = NULL;
+  SinglyLinkedListStatus status = create_pooled_node(singly_linked_list, node_data, &new_node);
+
+  if (status != SINGLY_LINKED_LIST_SUCCESS)
+  {
+    return status;
+  }
+
+  Node *predecessor_node = find_predecessor_in_sorted_list(singly_linked_list, node_data, true);
+
+  if (predecessor_node == NULL)
+  {
+    new_node->next_node = singly_linked_list->head_node;
+    singly_linked_list->head_node = new_node;
+  }
+  else
+  {
+    new_node->next_node = predecessor_node->next_node;
+    predecessor_node->next_node = new_node;
+  }
+
+  if (new_node->next_node == NULL)
+  {
+    singly_linked_list->tail_node = new_node;
+  }
+
+  singly_linked_list->length++;
+
+  index_inserted_node(singly_linked_list, new_node);
+
+  if (singly_linked_list->skip_list_index != NULL && !insert_node_into_skip_list_index(singly_linked_list->skip_list_index, new_node))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "The skip list index could not be updated and has been detached.");
+
+    detach_skip_list_index(singly_linked_list);
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Searches the sorted singly linked list for the first node whose data is equivalent to the provided data.
+ *
+ * Nodes are matched with the `order_data_function` of the list rather than its compare function. With a skip
+ * list index attached, the search takes expected O(log n) time; otherwise the list is scanned from its head
+ * and the scan stops at the first node that goes after `node_data`.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ *
+ * \return A pointer to the first node containing equivalent data, or `NULL` if no node is found.
+ */
+Node *find_node_in_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  Node *found_node = NULL;
+
+  try_find_node_in_sorted_list(singly_linked_list, node_data, &found_node);
+
+  return found_node;
+}
+
+/**
+ * \brief Searches the sorted singly linked list for the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `find_node_in_sorted_list`. Not finding a matching node is not an error: the function
+ * succeeds and stores `NULL` in `found_node`.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list to search in.
+ * \param node_data The data to search for in the singly linked list.
+ * \param found_node Where the matching node, or `NULL` if there is none, is stored.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_find_node_in_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data, Node **found_node)
+{
+  if (found_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'found_node' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  *found_node = NULL;
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search for a node in a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list->order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot search in order in a singly linked list without an order function.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  Node *predecessor_node = find_predecessor_in_sorted_list(singly_linked_list, node_data, false);
+  Node *candidate_node = predecessor_node == NULL ? singly_linked_list->head_node : predecessor_node->next_node;
+
+  if (candidate_node != NULL && singly_linked_list->order_data_function(candidate_node->node_data, node_data) == 0)
+  {
+    *found_node = candidate_node;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Deletes every node of the sorted singly linked list whose data is equivalent to the provided data.
+ *
+ * The matching nodes are found like in `find_node_in_sorted_list` and, being adjacent, are unlinked in a single
+ * splice. Their data is freed, they are returned to the node pool of the list, and they are removed from the
+ * attached indexes.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list.
+ *
+ * \return The number of nodes that were deleted from the list, saturated to `INT_MAX`.
+ */
+int delete_node_from_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data)
+{
+  size_t deleted_nodes_count = 0;
+
+  try_delete_node_from_sorted_list(singly_linked_list, node_data, &deleted_nodes_count);
+
+  if (deleted_nodes_count > INT_MAX)
+  {
+    return INT_MAX;
+  }
+
+  return (int)deleted_nodes_count;
+}
+
+/**
+ * \brief Deletes the nodes of the sorted singly linked list equivalent to the provided data and reports the outcome as a status code.
+ *
+ * This function behaves like `delete_node_from_sorted_list`, but stores the exact number of deleted nodes.
+ *
+ * \param singly_linked_list A pointer to the sorted singly linked list from which nodes will be deleted.
+ * \param node_data The data to search for in the singly linked list.
+ * \param deleted_nodes_count Where the number of deleted nodes is stored. This can be `NULL` if it is not needed.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be searched.
+ */
+SinglyLinkedListStatus try_delete_node_from_sorted_list(SinglyLinkedList *singly_linked_list, NodeData node_data, size_t *deleted_nodes_count)
+{
+  size_t deleted_count = 0;
+
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = 0;
+  }
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete a node on a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (singly_linked_list->order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "You cannot delete a node in order from a singly linked list without an order function.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  Node *predecessor_node = find_predecessor_in_sorted_list(singly_linked_list, node_data, false);
+  Node *current_node = predecessor_node == NULL ? singly_linked_list->head_node : predecessor_node->next_node;
+
+  while (current_node != NULL && singly_linked_list->order_data_function(current_node->node_data, node_data) == 0)
+  {
+    Node *node_to_delete = current_node;
+
+    current_node = current_node->next_node;
+
+    if (singly_linked_list->hash_index != NULL)
+    {
+      remove_node_from_hash_index(singly_linked_list->hash_index, node_to_delete);
+    }
+
+    if (singly_linked_list->skip_list_index != NULL)
+    {
+      remove_node_from_skip_list_index(singly_linked_list->skip_list_index, node_to_delete);
+    }
+
+    singly_linked_list->free_data_function(node_to_delete->node_data);
+
+    release_unlinked_node(singly_linked_list, node_to_delete, predecessor_node);
+
+    deleted_count++;
+  }
+
+  if (predecessor_node == NULL)
+  {
+    singly_linked_list->head_node = current_node;
+  }
+  else
+  {
+    predecessor_node->next_node = current_node;
+  }
+
+  if (current_node == NULL)
+  {
+    singly_linked_list->tail_node = predecessor_node;
+  }
+
+  singly_linked_list->length -= deleted_count;
+
+  if (deleted_nodes_count != NULL)
+  {
+    *deleted_nodes_count = deleted_count;
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
 }
@@ -0,0 +1,318 @@
+#include <stdlib.h>
+
+#include "../include/hash_index.h"
+#include "../include/singly_linked_list_compaction.h"
+#include "../include/skip_list_index.h"
+
+/**
+ * \brief Copies a node into a new location, moving its data if a relocate function is provided.
+ *
+ * \param source_node A pointer to the node to be copied.
+ * \param destination_node A pointer to the location the node is copied to.
+ * \param relocate_data_function A function pointer used to move the data of the node, or `NULL` to leave it in place.
+ */
+static void copy_compacted_node(Node *source_node, Node *destination_node, RelocateDataFunction relocate_data_function)
+{
+  destination_node->node_data = relocate_data_function != NULL ? relocate_data_function(source_node->node_data) : source_node->node_data;
+  destination_node->next_node = source_node->next_node;
+}
+
+/**
+ * \brief Adds a node that was just moved to the hash index of the singly linked list, if it has one.
+ *
+ * If the index cannot be grown to hold the node, it is detached from the list rather than left out
+ * of sync, and an error is reported.
+ *
+ * \param singly_linked_list A pointer to the `SinglyLinkedList` the node belongs to.
+ * \param node A pointer to the moved node.
+ */
+static void index_compacted_node(SinglyLinkedList *singly_linked_list, Node *node)
+{
+  if (singly_linked_list->hash_index != NULL && !insert_node_into_hash_index(singly_linked_list->hash_index, node))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "The hash index could not be updated and has been detached.");
+
+    detach_hash_index(singly_linked_list);
+  }
+}
+
+/**
+ * \brief Moves all the nodes of the singly linked list into a single contiguous block, in list order.
+ *
+ * After long sequences of insertions and deletions, the nodes of a list are scattered over its pool and consecutive
+ * nodes rarely share a cache line or a page. This function allocates one block of `length` nodes, copies every node
+ * into it in list order, rewrites `head_node` and `tail_node`, and returns all the previous slabs of the pool to the
+ * system. The data of every node is passed to `relocate_data_function` if one is provided.
+ *
+ * Every `Node` pointer obtained from the list before the call is invalidated. An attached hash index and an
+ * attached skip list index are updated to the moved nodes. An incremental compaction in progress is canceled first.
+ * If the block cannot be allocated, an error is reported and the list is left untouched.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param relocate_data_function A function pointer used to move the data of every node, or `NULL` to leave it in place.
+ *
+ * \return true if the list was compacted, false if an error occurred and the list was left untouched.
+ */
+bool compact_singly_linked_list(SinglyLinkedList *singly_linked_list, RelocateDataFunction relocate_data_function)
+{
+  return try_compact_singly_linked_list(singly_linked_list, relocate_data_function) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Moves all the nodes of the singly linked list into a single contiguous block and reports the outcome as a status code.
+ *
+ * This function behaves like `compact_singly_linked_list`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param relocate_data_function A function pointer used to move the data of every node, or `NULL` to leave it in place.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be compacted.
+ */
+SinglyLinkedListStatus try_compact_singly_linked_list(SinglyLinkedList *singly_linked_list, RelocateDataFunction relocate_data_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot compact a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  if (singly_linked_list->length == 0)
+  {
+    destroy_node_pool(&singly_linked_list->node_pool);
+
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  NodePool compacted_node_pool;
+
+  initialize_node_pool(&compacted_node_pool);
+
+  Node *compacted_nodes = allocate_node_run_from_pool(&compacted_node_pool, singly_linked_list->length);
+
+  if (compacted_nodes == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'compacted_nodes'.");
+
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  if (singly_linked_list->hash_index != NULL)
+  {
+    clear_hash_index(singly_linked_list->hash_index);
+  }
+
+  SkipListTower *current_tower = NULL;
+
+  if (singly_linked_list->skip_list_index != NULL && singly_linked_list->skip_list_index->lane_count > 0)
+  {
+    current_tower = singly_linked_list->skip_list_index->first_towers[0];
+  }
+
+  Node *current_node = singly_linked_list->head_node;
+  size_t node_index = 0;
+
+  while (current_node != NULL)
+  {
+    Node *compacted_node = &compacted_nodes[node_index];
+
+    copy_compacted_node(current_node, compacted_node, relocate_data_function);
+
+    if (current_tower != NULL && current_tower->node == current_node)
+    {
+      current_tower->node = compacted_node;
+      current_tower = current_tower->next_towers[0];
+    }
+
+    if (compacted_node->next_node != NULL)
+    {
+      compacted_node->next_node = &compacted_nodes[node_index + 1];
+    }
+
+    index_compacted_node(singly_linked_list, compacted_node);
+
+    current_node = current_node->next_node;
+    node_index++;
+  }
+
+  destroy_node_pool(&singly_linked_list->node_pool);
+  move_node_pool(&singly_linked_list->node_pool, &compacted_node_pool);
+
+  singly_linked_list->head_node = compacted_nodes;
+  singly_linked_list->tail_node = &compacted_nodes[node_index - 1];
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Moves at most the provided number of nodes of the singly linked list into a fresh pool, in list order.
+ *
+ * The first call starts an incremental compaction: the current pool of the list is set aside and new nodes,
+ * including the ones inserted until the compaction ends, are allocated from a fresh pool. Every call then moves
+ * the next `max_node_count` nodes after the last moved one, so the work done per call is bounded and the calls can
+ * be spread between other operations. Once the node that was the tail when the compaction started has been moved,
+ * the set aside pool is returned to the system and the compaction ends. The nodes inserted after it are already in
+ * the fresh pool, so they are not moved again.
+ *
+ * Insertions and deletions may happen between calls. Operations that relink the existing nodes, such as reversing
+ * or sorting the list, cancel the compaction, keeping the nodes moved so far. Every `Node` pointer to a moved node is
+ * invalidated. An attached hash index is updated to the moved nodes, and an attached skip list index is detached
+ * when the compaction starts.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param max_node_count The maximum number of nodes to move in this call. This must be greater than 0.
+ * \param relocate_data_function A function pointer used to move the data of every moved node, or `NULL` to leave it in place.
+ *
+ * \return true if the compaction is complete, false if nodes remain to be moved or an error occurred.
+ */
+bool compact_singly_linked_list_incrementally(SinglyLinkedList *singly_linked_list, size_t max_node_count, RelocateDataFunction relocate_data_function)
+{
+  bool is_compaction_complete = false;
+
+  if (try_compact_singly_linked_list_incrementally(singly_linked_list, max_node_count, relocate_data_function, &is_compaction_complete) != SINGLY_LINKED_LIST_SUCCESS)
+  {
+    return false;
+  }
+
+  return is_compaction_complete;
+}
+
+/**
+ * \brief Moves at most the provided number of nodes of the singly linked list into a fresh pool and reports the outcome as a status code.
+ *
+ * This function behaves like `compact_singly_linked_list_incrementally`. If a node cannot be allocated, the
+ * nodes moved so far stay moved and the compaction remains in progress.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be compacted.
+ * \param max_node_count The maximum number of nodes to move in this call. This must be greater than 0.
+ * \param relocate_data_function A function pointer used to move the data of every moved node, or `NULL` to leave it in place.
+ * \param is_compaction_complete Where whether the compaction is complete is stored on success. This can be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the nodes could not be moved.
+ */
+SinglyLinkedListStatus try_compact_singly_linked_list_incrementally(SinglyLinkedList *singly_linked_list, size_t max_node_count, RelocateDataFunction relocate_data_function, bool *is_compaction_complete)
+{
+  if (is_compaction_complete != NULL)
+  {
+    *is_compaction_complete = false;
+  }
+
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot compact a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (max_node_count == 0)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT, "'max_node_count' must be greater than 0.");
+
+    return SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (!singly_linked_list->is_compacting)
+  {
+    detach_skip_list_index(singly_linked_list);
+
+    move_node_pool(&singly_linked_list->compaction_source_pool, &singly_linked_list->node_pool);
+
+    singly_linked_list->last_compacted_node = NULL;
+    singly_linked_list->compaction_end_node = singly_linked_list->tail_node;
+    singly_linked_list->is_compacting = true;
+  }
+
+  Node *previous_node = singly_linked_list->last_compacted_node;
+  Node *current_node = previous_node != NULL ? previous_node->next_node : singly_linked_list->head_node;
+
+  /* The compaction ends once the last node to move has been moved, or right away if no such node is left. */
+  for (size_t moved_nodes_count = 0; moved_nodes_count < max_node_count && previous_node != singly_linked_list->compaction_end_node; moved_nodes_count++)
+  {
+    Node *compacted_node = allocate_node_from_pool(&singly_linked_list->node_pool);
+
+    if (compacted_node == NULL)
+    {
+      REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'compacted_node'.");
+
+      return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+    }
+
+    if (singly_linked_list->hash_index != NULL)
+    {
+      remove_node_from_hash_index(singly_linked_list->hash_index, current_node);
+    }
+
+    copy_compacted_node(current_node, compacted_node, relocate_data_function);
+
+    if (previous_node == NULL)
+    {
+      singly_linked_list->head_node = compacted_node;
+    }
+    else
+    {
+      previous_node->next_node = compacted_node;
+    }
+
+    if (singly_linked_list->tail_node == current_node)
+    {
+      singly_linked_list->tail_node = compacted_node;
+    }
+
+    if (singly_linked_list->compaction_end_node == current_node)
+    {
+      singly_linked_list->compaction_end_node = compacted_node;
+    }
+
+    index_compacted_node(singly_linked_list, compacted_node);
+
+    previous_node = compacted_node;
+    current_node = compacted_node->next_node;
+
+    singly_linked_list->last_compacted_node = compacted_node;
+  }
+
+  if (previous_node == singly_linked_list->compaction_end_node)
+  {
+    destroy_node_pool(&singly_linked_list->compaction_source_pool);
+
+    singly_linked_list->last_compacted_node = NULL;
+    singly_linked_list->compaction_end_node = NULL;
+    singly_linked_list->is_compacting = false;
+
+    if (is_compaction_complete != NULL)
+    {
+      *is_compaction_complete = true;
+    }
+  }
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Cancels the incremental compaction of the singly linked list in progress, if there is one.
+ *
+ * The nodes moved so far stay where they are, and the set aside pool is merged back into the pool of the list,
+ * so no node is invalidated. Operations that relink the existing nodes of a list call this function themselves.
+ *
+ * \param singly_linked_list A pointer to the singly linked list whose compaction is canceled.
+ */
+void cancel_singly_linked_list_compaction(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot cancel the compaction of a NULL singly linked list.");
+
+    return;
+  }
+
+  if (singly_linked_list->is_compacting)
+  {
+    merge_node_pools(&singly_linked_list->node_pool, &singly_linked_list->compaction_source_pool);
+
+    singly_linked_list->last_compacted_node = NULL;
+    singly_linked_list->compaction_end_node = NULL;
+    singly_linked_list->is_compacting = false;
+  }
+}
@@ -0,0 +1,680 @@
+#include <limits.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/singly_linked_list_compaction.h"
+#include "../include/singly_linked_list_sort.h"
+
+/**
+ * \def SORT_PENDING_RUN_LEVELS
+ * \brief The number of pending runs kept by the merge sort.
+ *
+ * The pending run at level `i` holds exactly `2^i` nodes, so one level per bit of `size_t` is enough for any list.
+ */
+#define SORT_PENDING_RUN_LEVELS (sizeof(size_t) * CHAR_BIT)
+
+/**
+ * \def RADIX_SORT_BUCKET_COUNT
+ * \brief The number of bucket chains of the radix sorts, one per value of a key byte.
+ */
+#define RADIX_SORT_BUCKET_COUNT 256
+
+/**
+ * \struct SortTask
+ * \brief A structure representing the share of a parallel sort done by one thread.
+ *
+ * A task either sorts the run starting at `first_head`, or merges it with the run starting at `second_head`.
+ * Either way the resulting run is stored back in `first_head` and `first_tail`.
+ */
+typedef struct SortTask
+{
+  Node *first_head;                      /**< The first node of the run this task sorts, or of the first run it merges. */
+  Node *first_tail;                      /**< The last node of the first run. */
+  Node *second_head;                     /**< The first node of the second run this task merges. */
+  Node *second_tail;                     /**< The last node of the second run. */
+  OrderDataFunction order_data_function; /**< Function pointer for ordering node data. */
+  pthread_t thread;                      /**< The thread running this task, if `has_thread` is true. */
+  bool has_thread;                       /**< Whether the task runs on its own thread rather than the calling one. */
+} SortTask;
+
+/**
+ * \brief Merges two sorted, `NULL`-terminated runs of nodes into a single sorted run.
+ *
+ * When two nodes are equivalent, the one from `first_run` goes first, which keeps the sort stable as long as
+ * `first_run` holds the nodes that came first in the list.
+ *
+ * \param first_run The first node of the run that came first in the list.
+ * \param first_tail The last node of `first_run`.
+ * \param second_run The first node of the run that came second in the list.
+ * \param second_tail The last node of `second_run`.
+ * \param order_data_function A function pointer used to order node data.
+ * \param merged_tail Where the last node of the merged run is stored.
+ *
+ * \return The first node of the merged run.
+ */
+static Node *merge_sorted_runs(Node *first_run, Node *first_tail, Node *second_run, Node *second_tail, OrderDataFunction order_data_function, Node **merged_tail)
+{
+  Node merged_head;
+  Node *last_node = &merged_head;
+
+  while (first_run != NULL && second_run != NULL)
+  {
+    if (order_data_function(second_run->node_data, first_run->node_data) < 0)
+    {
+      last_node->next_node = second_run;
+      second_run = second_run->next_node;
+    }
+    else
+    {
+      last_node->next_node = first_run;
+      first_run = first_run->next_node;
+    }
+
+    last_node = last_node->next_node;
+  }
+
+  if (first_run != NULL)
+  {
+    last_node->next_node = first_run;
+
+    *merged_tail = first_tail;
+  }
+  else
+  {
+    last_node->next_node = second_run;
+
+    *merged_tail = second_tail;
+  }
+
+  return merged_head.next_node;
+}
+
+/**
+ * \brief Sorts a `NULL`-terminated chain of nodes with a bottom-up merge sort.
+ *
+ * The chain is split into single nodes that are merged into one pending run per power of two, like the digits
+ * of a binary counter, and the pending runs are merged together at the end.
+ *
+ * \param chain_head The first node of the chain. This cannot be `NULL`.
+ * \param order_data_function A function pointer used to order node data.
+ * \param sorted_tail_node Where the last node of the sorted chain is stored.
+ *
+ * \return The first node of the sorted chain.
+ */
+static Node *sort_node_chain(Node *chain_head, OrderDataFunction order_data_function, Node **sorted_tail_node)
+{
+  Node *pending_runs[SORT_PENDING_RUN_LEVELS] = {NULL};
+  Node *pending_tails[SORT_PENDING_RUN_LEVELS] = {NULL};
+  Node *current_node = chain_head;
+  Node *sorted_head = NULL;
+  Node *sorted_tail = NULL;
+
+  while (current_node != NULL)
+  {
+    Node *next_node = current_node->next_node;
+    size_t run_level = 0;
+
+    current_node->next_node = NULL;
+
+    sorted_head = current_node;
+    sorted_tail = current_node;
+
+    while (pending_runs[run_level] != NULL)
+    {
+      sorted_head = merge_sorted_runs(pending_runs[run_level], pending_tails[run_level], sorted_head, sorted_tail, order_data_function, &sorted_tail);
+
+      pending_runs[run_level] = NULL;
+
+      run_level++;
+    }
+
+    pending_runs[run_level] = sorted_head;
+    pending_tails[run_level] = sorted_tail;
+
+    current_node = next_node;
+  }
+
+  sorted_head = NULL;
+
+  for (size_t run_level = 0; run_level < SORT_PENDING_RUN_LEVELS; run_level++)
+  {
+    if (pending_runs[run_level] == NULL)
+    {
+      continue;
+    }
+
+    if (sorted_head == NULL)
+    {
+      sorted_head = pending_runs[run_level];
+      sorted_tail = pending_tails[run_level];
+    }
+    else
+    {
+      sorted_head = merge_sorted_runs(pending_runs[run_level], pending_tails[run_level], sorted_head, sorted_tail, order_data_function, &sorted_tail);
+    }
+  }
+
+  *sorted_tail_node = sorted_tail;
+
+  return sorted_head;
+}
+
+/**
+ * \brief Sorts the singly linked list in place with a bottom-up merge sort.
+ *
+ * This function orders the nodes of the list with the `order_data_function` of the list by relinking their
+ * `next_node` pointers, so no node is allocated, copied or moved, and updates `head_node` and `tail_node`.
+ * The sort is stable and runs in O(n log n) time. Instead of recursing, it keeps one pending sorted run per
+ * power of two, like the digits of a binary counter, so the only extra space is a fixed array of pending runs.
+ * An attached hash index stays valid, since the nodes keep their addresses, and so does an attached skip list
+ * index, since a stable sort leaves a list already sorted by the same function unchanged.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool sort_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  return try_sort_singly_linked_list(singly_linked_list) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the singly linked list in place and reports the outcome as a status code.
+ *
+ * This function behaves like `sort_singly_linked_list`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_sort_singly_linked_list(SinglyLinkedList *singly_linked_list)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot sort a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  OrderDataFunction order_data_function = singly_linked_list->order_data_function;
+
+  if (order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'order_data_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  if (singly_linked_list->head_node == NULL)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  Node *sorted_tail = NULL;
+
+  singly_linked_list->head_node = sort_node_chain(singly_linked_list->head_node, order_data_function, &sorted_tail);
+  singly_linked_list->tail_node = sorted_tail;
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the run of a sort task.
+ *
+ * \param sort_task A pointer to the `SortTask` whose run is sorted.
+ *
+ * \return Always `NULL`.
+ */
+static void *sort_run_of_task(void *sort_task)
+{
+  SortTask *task = (SortTask *)sort_task;
+
+  task->first_head = sort_node_chain(task->first_head, task->order_data_function, &task->first_tail);
+
+  return NULL;
+}
+
+/**
+ * \brief Merges the two runs of a sort task.
+ *
+ * \param sort_task A pointer to the `SortTask` whose runs are merged.
+ *
+ * \return Always `NULL`.
+ */
+static void *merge_runs_of_task(void *sort_task)
+{
+  SortTask *task = (SortTask *)sort_task;
+
+  task->first_head = merge_sorted_runs(task->first_head, task->first_tail, task->second_head, task->second_tail, task->order_data_function, &task->first_tail);
+
+  return NULL;
+}
+
+/**
+ * \brief Runs a batch of sort tasks concurrently and waits for all of them.
+ *
+ * The first task runs on the calling thread and every other one on a new thread. A task whose thread cannot be
+ * started runs on the calling thread once the others have been started.
+ *
+ * \param sort_tasks The tasks to be run.
+ * \param task_count The number of tasks in `sort_tasks`.
+ * \param task_function The function that runs a single task.
+ */
+static void run_sort_tasks(SortTask *sort_tasks, size_t task_count, void *(*task_function)(void *))
+{
+  for (size_t task_index = 1; task_index < task_count; task_index++)
+  {
+    sort_tasks[task_index].has_thread = pthread_create(&sort_tasks[task_index].thread, NULL, task_function, &sort_tasks[task_index]) == 0;
+  }
+
+  task_function(&sort_tasks[0]);
+
+  for (size_t task_index = 1; task_index < task_count; task_index++)
+  {
+    if (sort_tasks[task_index].has_thread)
+    {
+      pthread_join(sort_tasks[task_index].thread, NULL);
+    }
+    else
+    {
+      task_function(&sort_tasks[task_index]);
+    }
+  }
+}
+
+/**
+ * \brief Sorts the singly linked list in place using several threads.
+ *
+ * This function splits the chain of nodes into one run of consecutive nodes per thread, sorts the runs
+ * concurrently with the same merge sort as `sort_singly_linked_list`, and then merges them pairwise, one
+ * round of concurrent merges at a time, until a single run is left. The result is stable and identical to the
+ * one of `sort_singly_linked_list`. The threads are started for each call and joined before it returns. If a
+ * thread cannot be started, its share of the work is done by the calling thread instead.
+ *
+ * Splitting the chain and the last merge visit every node on a single thread, so the speedup is bounded by
+ * the memory bandwidth available to one core for those two passes.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param thread_count The maximum number of threads to use, including the calling thread. 0 is treated as 1.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool sort_singly_linked_list_in_parallel(SinglyLinkedList *singly_linked_list, size_t thread_count)
+{
+  return try_sort_singly_linked_list_in_parallel(singly_linked_list, thread_count) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the singly linked list in place using several threads and reports the outcome as a status code.
+ *
+ * This function behaves like `sort_singly_linked_list_in_parallel`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param thread_count The maximum number of threads to use, including the calling thread. 0 is treated as 1.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_sort_singly_linked_list_in_parallel(SinglyLinkedList *singly_linked_list, size_t thread_count)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot sort a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  size_t run_count = singly_linked_list->length / PARALLEL_SORT_MINIMUM_NODES_PER_THREAD;
+
+  if (run_count > thread_count)
+  {
+    run_count = thread_count;
+  }
+
+  if (run_count <= 1)
+  {
+    return try_sort_singly_linked_list(singly_linked_list);
+  }
+
+  OrderDataFunction order_data_function = singly_linked_list->order_data_function;
+
+  if (order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'order_data_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  SortTask *sort_tasks = (SortTask *)malloc(run_count * sizeof(SortTask));
+
+  if (sort_tasks == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'sort_tasks'.");
+
+    return SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED;
+  }
+
+  size_t shortest_run_length = singly_linked_list->length / run_count;
+  size_t longer_run_count = singly_linked_list->length % run_count;
+  Node *current_node = singly_linked_list->head_node;
+
+  for (size_t run_index = 0; run_index < run_count; run_index++)
+  {
+    size_t run_length = shortest_run_length + (run_index < longer_run_count ? 1 : 0);
+
+    sort_tasks[run_index].first_head = current_node;
+    sort_tasks[run_index].order_data_function = order_data_function;
+
+    for (size_t node_index = 1; node_index < run_length; node_index++)
+    {
+      current_node = current_node->next_node;
+    }
+
+    Node *next_node = current_node->next_node;
+
+    current_node->next_node = NULL;
+    current_node = next_node;
+  }
+
+  run_sort_tasks(sort_tasks, run_count, sort_run_of_task);
+
+  while (run_count > 1)
+  {
+    size_t merge_count = run_count / 2;
+
+    for (size_t merge_index = 0; merge_index < merge_count; merge_index++)
+    {
+      Node *first_head = sort_tasks[2 * merge_index].first_head;
+      Node *first_tail = sort_tasks[2 * merge_index].first_tail;
+
+      sort_tasks[merge_index].second_head = sort_tasks[2 * merge_index + 1].first_head;
+      sort_tasks[merge_index].second_tail = sort_tasks[2 * merge_index + 1].first_tail;
+      sort_tasks[merge_index].first_head = first_head;
+      sort_tasks[merge_index].first_tail = first_tail;
+    }
+
+    if (run_count % 2 != 0)
+    {
+      sort_tasks[merge_count].first_head = sort_tasks[run_count - 1].first_head;
+      sort_tasks[merge_count].first_tail = sort_tasks[run_count - 1].first_tail;
+    }
+
+    run_sort_tasks(sort_tasks, merge_count, merge_runs_of_task);
+
+    run_count = merge_count + run_count % 2;
+  }
+
+  singly_linked_list->head_node = sort_tasks[0].first_head;
+  singly_linked_list->tail_node = sort_tasks[0].first_tail;
+
+  free(sort_tasks);
+
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Appends a node to the bucket chain of a radix sort pass.
+ *
+ * \param bucket_heads The first node of every bucket chain, or `NULL` for the empty ones.
+ * \param bucket_tails The last node of every bucket chain.
+ * \param bucket_index The bucket the node is appended to.
+ * \param node A pointer to the node to be appended.
+ */
+static void append_node_to_radix_bucket(Node **bucket_heads, Node **bucket_tails, size_t bucket_index, Node *node)
+{
+  if (bucket_heads[bucket_index] == NULL)
+  {
+    bucket_heads[bucket_index] = node;
+  }
+  else
+  {
+    bucket_tails[bucket_index]->next_node = node;
+  }
+
+  bucket_tails[bucket_index] = node;
+}
+
+/**
+ * \brief Concatenates the bucket chains of a radix sort pass, in bucket order, into a single chain.
+ *
+ * At least one bucket must hold a node.
+ *
+ * \param bucket_heads The first node of every bucket chain, or `NULL` for the empty ones.
+ * \param bucket_tails The last node of every bucket chain.
+ * \param concatenated_tail Where the last node of the resulting chain is stored.
+ *
+ * \return The first node of the resulting chain.
+ */
+static Node *concatenate_radix_buckets(Node **bucket_heads, Node **bucket_tails, Node **concatenated_tail)
+{
+  Node *concatenated_head = NULL;
+  Node *last_node = NULL;
+
+  for (size_t bucket_index = 0; bucket_index < RADIX_SORT_BUCKET_COUNT; bucket_index++)
+  {
+    if (bucket_heads[bucket_index] == NULL)
+    {
+      continue;
+    }
+
+    if (last_node == NULL)
+    {
+      concatenated_head = bucket_heads[bucket_index];
+    }
+    else
+    {
+      last_node->next_node = bucket_heads[bucket_index];
+    }
+
+    last_node = bucket_tails[bucket_index];
+  }
+
+  last_node->next_node = NULL;
+
+  *concatenated_tail = last_node;
+
+  return concatenated_head;
+}
+
+/**
+ * \brief Sorts the singly linked list in place with an LSD radix sort on an integer key.
+ *
+ * This function distributes the nodes into 256 bucket chains by one byte of their key at a time, starting from
+ * the least significant one, and concatenates the chains through their `next_node` pointers after every pass,
+ * so no memory is allocated. Bytes that are equal in every key are skipped, so small keys take fewer than the
+ * eight passes of a full 64-bit key. The sort is stable and runs in linear time. The key function is called
+ * once per node and pass, and `head_node` and `tail_node` are updated. Since the key order may differ from the
+ * `order_data_function` of the list, any attached skip list index is detached.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param integer_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool radix_sort_singly_linked_list_by_integer_key(SinglyLinkedList *singly_linked_list, IntegerKeyFunction integer_key_function)
+{
+  return try_radix_sort_singly_linked_list_by_integer_key(singly_linked_list, integer_key_function) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the singly linked list with an LSD radix sort on an integer key and reports the outcome as a status code.
+ *
+ * This function behaves like `radix_sort_singly_linked_list_by_integer_key`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param integer_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_radix_sort_singly_linked_list_by_integer_key(SinglyLinkedList *singly_linked_list, IntegerKeyFunction integer_key_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot sort a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (integer_key_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'integer_key_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  if (singly_linked_list->head_node == NULL)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  uint64_t bits_set_in_every_key = UINT64_MAX;
+  uint64_t bits_set_in_any_key = 0;
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    uint64_t node_key = integer_key_function(current_node->node_data);
+
+    bits_set_in_every_key &= node_key;
+    bits_set_in_any_key |= node_key;
+  }
+
+  uint64_t varying_bits = bits_set_in_every_key ^ bits_set_in_any_key;
+  Node *bucket_heads[RADIX_SORT_BUCKET_COUNT];
+  Node *bucket_tails[RADIX_SORT_BUCKET_COUNT];
+  Node *sorted_head = singly_linked_list->head_node;
+  Node *sorted_tail = singly_linked_list->tail_node;
+
+  for (unsigned int key_shift = 0; key_shift < 64; key_shift += CHAR_BIT)
+  {
+    if (((varying_bits >> key_shift) & 0xFF) == 0)
+    {
+      continue;
+    }
+
+    memset(bucket_heads, 0, sizeof(bucket_heads));
+
+    Node *current_node = sorted_head;
+
+    while (current_node != NULL)
+    {
+      Node *next_node = current_node->next_node;
+      size_t bucket_index = (size_t)((integer_key_function(current_node->node_data) >> key_shift) & 0xFF);
+
+      append_node_to_radix_bucket(bucket_heads, bucket_tails, bucket_index, current_node);
+
+      current_node = next_node;
+    }
+
+    sorted_head = concatenate_radix_buckets(bucket_heads, bucket_tails, &sorted_tail);
+  }
+
+  singly_linked_list->head_node = sorted_head;
+  singly_linked_list->tail_node = sorted_tail;
+
+  detach_skip_list_index(singly_linked_list);
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the singly linked list in place with an LSD radix sort on a byte string key.
+ *
+ * This function works like `radix_sort_singly_linked_list_by_integer_key`, with one pass per byte of the longest
+ * key, starting from the last one. It runs in time proportional to the number of nodes times the length of the
+ * longest key, so it suits fixed-width keys best.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param byte_string_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return true if the list was sorted, false if an error occurred and the list was left untouched.
+ */
+bool radix_sort_singly_linked_list_by_byte_string_key(SinglyLinkedList *singly_linked_list, ByteStringKeyFunction byte_string_key_function)
+{
+  return try_radix_sort_singly_linked_list_by_byte_string_key(singly_linked_list, byte_string_key_function) == SINGLY_LINKED_LIST_SUCCESS;
+}
+
+/**
+ * \brief Sorts the singly linked list with an LSD radix sort on a byte string key and reports the outcome as a status code.
+ *
+ * This function behaves like `radix_sort_singly_linked_list_by_byte_string_key`.
+ *
+ * \param singly_linked_list A pointer to the singly linked list to be sorted.
+ * \param byte_string_key_function A function pointer used to extract the key of a node. This cannot be `NULL`.
+ *
+ * \return `SINGLY_LINKED_LIST_SUCCESS`, or the reason the list could not be sorted.
+ */
+SinglyLinkedListStatus try_radix_sort_singly_linked_list_by_byte_string_key(SinglyLinkedList *singly_linked_list, ByteStringKeyFunction byte_string_key_function)
+{
+  if (!is_valid_singly_linked_list(singly_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot sort a NULL singly linked list.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_LIST;
+  }
+
+  if (byte_string_key_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'byte_string_key_function' cannot be NULL.");
+
+    return SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT;
+  }
+
+  if (singly_linked_list->head_node == NULL)
+  {
+    return SINGLY_LINKED_LIST_SUCCESS;
+  }
+
+  size_t longest_key_length = 0;
+
+  for (Node *current_node = singly_linked_list->head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    size_t key_length = 0;
+
+    byte_string_key_function(current_node->node_data, &key_length);
+
+    if (key_length > longest_key_length)
+    {
+      longest_key_length = key_length;
+    }
+  }
+
+  Node *bucket_heads[RADIX_SORT_BUCKET_COUNT];
+  Node *bucket_tails[RADIX_SORT_BUCKET_COUNT];
+  Node *sorted_head = singly_linked_list->head_node;
+  Node *sorted_tail = singly_linked_list->tail_node;
+
+  for (size_t byte_position = longest_key_length; byte_position > 0; byte_position--)
+  {
+    memset(bucket_heads, 0, sizeof(bucket_heads));
+
+    Node *current_node = sorted_head;
+
+    while (current_node != NULL)
+    {
+      Node *next_node = current_node->next_node;
+      size_t key_length = 0;
+      const unsigned char *key_bytes = byte_string_key_function(current_node->node_data, &key_length);
+      size_t bucket_index = byte_position <= key_length ? key_bytes[byte_position - 1] : 0;
+
+      append_node_to_radix_bucket(bucket_heads, bucket_tails, bucket_index, current_node);
+
+      current_node = next_node;
+    }
+
+    sorted_head = concatenate_radix_buckets(bucket_heads, bucket_tails, &sorted_tail);
+  }
+
+  singly_linked_list->head_node = sorted_head;
+  singly_linked_list->tail_node = sorted_tail;
+
+  detach_skip_list_index(singly_linked_list);
+  cancel_singly_linked_list_compaction(singly_linked_list);
+
+  return SINGLY_LINKED_LIST_SUCCESS;
+}
@@ -0,0 +1,71 @@
+#include <stddef.h>
+
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief The function notified of every error reported by the library, or `NULL` if there is none.
+ */
+static ErrorHandlerFunction error_handler = NULL;
+
+/**
+ * \brief Sets the function notified of every error reported by the library.
+ *
+ * The handler is global and is not synchronized, so it should be set before the library is used by
+ * several threads. Passing `NULL` removes the current handler.
+ *
+ * \param error_handler_function A function pointer called on every error, or `NULL`.
+ */
+void set_singly_linked_list_error_handler(ErrorHandlerFunction error_handler_function)
+{
+  error_handler = error_handler_function;
+}
+
+/**
+ * \brief Returns a static, human-readable description of a status.
+ *
+ * \param status The status to be described.
+ *
+ * \return The description of the status.
+ */
+const char *get_singly_linked_list_status_message(SinglyLinkedListStatus status)
+{
+  switch (status)
+  {
+  case SINGLY_LINKED_LIST_SUCCESS:
+    return "Success.";
+  case SINGLY_LINKED_LIST_ERROR_NULL_LIST:
+    return "The singly linked list is NULL.";
+  case SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT:
+    return "A required argument is NULL.";
+  case SINGLY_LINKED_LIST_ERROR_NULL_DATA:
+    return "The node data is NULL.";
+  case SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED:
+    return "Memory allocation failed.";
+  case SINGLY_LINKED_LIST_ERROR_EMPTY_LIST:
+    return "The singly linked list is empty.";
+  case SINGLY_LINKED_LIST_ERROR_CAPACITY_EXCEEDED:
+    return "A fixed capacity was exceeded.";
+  case SINGLY_LINKED_LIST_ERROR_NOT_SORTED:
+    return "The singly linked list is not sorted.";
+  case SINGLY_LINKED_LIST_ERROR_INVALID_ARGUMENT:
+    return "An argument is out of range.";
+  }
+
+  return "Unknown status.";
+}
+
+/**
+ * \brief Notifies the error handler, if one is set, of an error.
+ *
+ * This function is called by `REPORT_SINGLY_LINKED_LIST_ERROR` and does not print anything.
+ *
+ * \param status The status of the failed operation.
+ * \param message A static description of the error.
+ */
+void report_singly_linked_list_error(SinglyLinkedListStatus status, const char *message)
+{
+  if (error_handler != NULL)
+  {
+    error_handler(status, message);
+  }
+}
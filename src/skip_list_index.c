@@ -0,0 +1,369 @@
+#include <stdlib.h>
+
+#include "../include/singly_linked_list_status.h"
+#include "../include/skip_list_index.h"
+
+/**
+ * \brief The seed of the generator of tower heights of every new skip list index.
+ */
+#define SKIP_LIST_INDEX_RANDOM_SEED 0x9E3779B97F4A7C15ULL
+
+/**
+ * \brief Creates a new empty skip list index.
+ *
+ * \param order_data_function A function pointer used to order node data. This cannot be `NULL`.
+ *
+ * \return A pointer to the newly created `SkipListIndex` if successful, or `NULL` if an error occurs.
+ */
+SkipListIndex *create_skip_list_index(OrderDataFunction order_data_function)
+{
+  if (order_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'order_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  SkipListIndex *skip_list_index = (SkipListIndex *)malloc(sizeof(SkipListIndex));
+
+  if (skip_list_index == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'skip_list_index'.");
+
+    return NULL;
+  }
+
+  for (size_t lane_index = 0; lane_index < SKIP_LIST_INDEX_MAX_LANES; lane_index++)
+  {
+    skip_list_index->first_towers[lane_index] = NULL;
+  }
+
+  skip_list_index->lane_count = 0;
+  skip_list_index->random_state = SKIP_LIST_INDEX_RANDOM_SEED;
+  skip_list_index->order_data_function = order_data_function;
+
+  return skip_list_index;
+}
+
+/**
+ * \brief Draws the height of a new tower.
+ *
+ * Every additional lane is reached with probability 1/4, so a node gets no tower at all three times out of four.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` whose generator is used.
+ *
+ * \return The number of lanes of the new tower, which may be 0.
+ */
+static size_t draw_tower_height(SkipListIndex *skip_list_index)
+{
+  uint64_t random_bits = skip_list_index->random_state;
+
+  random_bits ^= random_bits << 13;
+  random_bits ^= random_bits >> 7;
+  random_bits ^= random_bits << 17;
+
+  skip_list_index->random_state = random_bits;
+
+  size_t tower_height = 0;
+
+  while ((random_bits & 3) == 0 && tower_height < SKIP_LIST_INDEX_MAX_LANES)
+  {
+    tower_height++;
+    random_bits >>= 2;
+  }
+
+  return tower_height;
+}
+
+/**
+ * \brief Allocates a tower of the given height for a node. Its lanes are not linked.
+ *
+ * \param node A pointer to the node the tower belongs to.
+ * \param tower_height The number of lanes of the tower. This must be greater than 0.
+ *
+ * \return A pointer to the new tower, or `NULL` if the allocation fails.
+ */
+static SkipListTower *create_skip_list_tower(Node *node, size_t tower_height)
+{
+  SkipListTower *skip_list_tower = (SkipListTower *)malloc(sizeof(SkipListTower) + tower_height * sizeof(SkipListTower *));
+
+  if (skip_list_tower == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'skip_list_tower'.");
+
+    return NULL;
+  }
+
+  skip_list_tower->node = node;
+  skip_list_tower->height = tower_height;
+
+  return skip_list_tower;
+}
+
+/**
+ * \brief Finds, in every lane, the last tower whose node goes before the provided data.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to search in.
+ * \param node_data The data to search for.
+ * \param include_equivalent Whether towers whose data is equivalent to `node_data` also count as going before it.
+ * \param predecessor_towers Where the tower found in every lane in use is stored, or `NULL` if the lane has none.
+ */
+static void find_predecessor_towers(SkipListIndex *skip_list_index, NodeData node_data, bool include_equivalent, SkipListTower **predecessor_towers)
+{
+  SkipListTower *current_tower = NULL;
+
+  for (size_t lane_index = skip_list_index->lane_count; lane_index > 0; lane_index--)
+  {
+    size_t lane = lane_index - 1;
+    SkipListTower *next_tower = current_tower == NULL ? skip_list_index->first_towers[lane] : current_tower->next_towers[lane];
+
+    while (next_tower != NULL)
+    {
+      int order = skip_list_index->order_data_function(next_tower->node->node_data, node_data);
+
+      if (order > 0 || (order == 0 && !include_equivalent))
+      {
+        break;
+      }
+
+      current_tower = next_tower;
+      next_tower = current_tower->next_towers[lane];
+    }
+
+    predecessor_towers[lane] = current_tower;
+  }
+}
+
+/**
+ * \brief Builds the towers of the skip list index over a sorted chain of nodes.
+ *
+ * The index must be empty. The towers are appended to the lanes in a single pass over the chain.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be built.
+ * \param head_node The first node of the chain, which must be sorted by the order function of the index.
+ *
+ * \return true if the index was built, false if a tower could not be allocated.
+ */
+bool build_skip_list_index(SkipListIndex *skip_list_index, Node *head_node)
+{
+  SkipListTower *last_towers[SKIP_LIST_INDEX_MAX_LANES];
+
+  for (Node *current_node = head_node; current_node != NULL; current_node = current_node->next_node)
+  {
+    size_t tower_height = draw_tower_height(skip_list_index);
+
+    if (tower_height == 0)
+    {
+      continue;
+    }
+
+    SkipListTower *skip_list_tower = create_skip_list_tower(current_node, tower_height);
+
+    if (skip_list_tower == NULL)
+    {
+      clear_skip_list_index(skip_list_index);
+
+      return false;
+    }
+
+    for (size_t lane = 0; lane < tower_height; lane++)
+    {
+      if (lane < skip_list_index->lane_count)
+      {
+        last_towers[lane]->next_towers[lane] = skip_list_tower;
+      }
+      else
+      {
+        skip_list_index->first_towers[lane] = skip_list_tower;
+      }
+
+      skip_list_tower->next_towers[lane] = NULL;
+      last_towers[lane] = skip_list_tower;
+    }
+
+    if (tower_height > skip_list_index->lane_count)
+    {
+      skip_list_index->lane_count = tower_height;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * \brief Finds the last node reachable through the express lanes that goes before the provided data.
+ *
+ * The search can be continued along the `next_node` chain from the returned node, which is expected to be only
+ * a few nodes away from the position of the data.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to search in.
+ * \param node_data The data to search for.
+ * \param include_equivalent Whether nodes whose data is equivalent to `node_data` also count as going before it.
+ *
+ * \return A pointer to the node, or `NULL` if the search has to start from the head of the chain.
+ */
+Node *find_predecessor_in_skip_list_index(SkipListIndex *skip_list_index, NodeData node_data, bool include_equivalent)
+{
+  if (skip_list_index->lane_count == 0)
+  {
+    return NULL;
+  }
+
+  SkipListTower *predecessor_towers[SKIP_LIST_INDEX_MAX_LANES];
+
+  find_predecessor_towers(skip_list_index, node_data, include_equivalent, predecessor_towers);
+
+  return predecessor_towers[0] == NULL ? NULL : predecessor_towers[0]->node;
+}
+
+/**
+ * \brief Gives a node that was just linked into the chain a tower of random height, if it draws one.
+ *
+ * The node must have been linked after every node whose data is equivalent to its own.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` where the node will be added.
+ * \param node A pointer to the node to be indexed.
+ *
+ * \return true if the node was added, false if its tower could not be allocated.
+ */
+bool insert_node_into_skip_list_index(SkipListIndex *skip_list_index, Node *node)
+{
+  size_t tower_height = draw_tower_height(skip_list_index);
+
+  if (tower_height == 0)
+  {
+    return true;
+  }
+
+  SkipListTower *skip_list_tower = create_skip_list_tower(node, tower_height);
+
+  if (skip_list_tower == NULL)
+  {
+    return false;
+  }
+
+  SkipListTower *predecessor_towers[SKIP_LIST_INDEX_MAX_LANES];
+
+  find_predecessor_towers(skip_list_index, node->node_data, true, predecessor_towers);
+
+  for (size_t lane = skip_list_index->lane_count; lane < tower_height; lane++)
+  {
+    predecessor_towers[lane] = NULL;
+  }
+
+  for (size_t lane = 0; lane < tower_height; lane++)
+  {
+    if (predecessor_towers[lane] == NULL)
+    {
+      skip_list_tower->next_towers[lane] = skip_list_index->first_towers[lane];
+      skip_list_index->first_towers[lane] = skip_list_tower;
+    }
+    else
+    {
+      skip_list_tower->next_towers[lane] = predecessor_towers[lane]->next_towers[lane];
+      predecessor_towers[lane]->next_towers[lane] = skip_list_tower;
+    }
+  }
+
+  if (tower_height > skip_list_index->lane_count)
+  {
+    skip_list_index->lane_count = tower_height;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Removes the tower of a node from the skip list index, if it has one.
+ *
+ * The data of the node must still be valid, since it is ordered to locate the tower.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` from which the node will be removed.
+ * \param node A pointer to the node to be removed.
+ */
+void remove_node_from_skip_list_index(SkipListIndex *skip_list_index, Node *node)
+{
+  if (skip_list_index->lane_count == 0)
+  {
+    return;
+  }
+
+  SkipListTower *predecessor_towers[SKIP_LIST_INDEX_MAX_LANES];
+  SkipListTower *removed_tower = NULL;
+
+  find_predecessor_towers(skip_list_index, node->node_data, false, predecessor_towers);
+
+  for (size_t lane = 0; lane < skip_list_index->lane_count; lane++)
+  {
+    SkipListTower *previous_tower = predecessor_towers[lane];
+    SkipListTower *current_tower = previous_tower == NULL ? skip_list_index->first_towers[lane] : previous_tower->next_towers[lane];
+
+    while (current_tower != NULL && current_tower->node != node &&
+           skip_list_index->order_data_function(current_tower->node->node_data, node->node_data) == 0)
+    {
+      previous_tower = current_tower;
+      current_tower = current_tower->next_towers[lane];
+    }
+
+    if (current_tower == NULL || current_tower->node != node)
+    {
+      break;
+    }
+
+    if (previous_tower == NULL)
+    {
+      skip_list_index->first_towers[lane] = current_tower->next_towers[lane];
+    }
+    else
+    {
+      previous_tower->next_towers[lane] = current_tower->next_towers[lane];
+    }
+
+    removed_tower = current_tower;
+  }
+
+  free(removed_tower);
+
+  while (skip_list_index->lane_count > 0 && skip_list_index->first_towers[skip_list_index->lane_count - 1] == NULL)
+  {
+    skip_list_index->lane_count--;
+  }
+}
+
+/**
+ * \brief Removes every tower from the skip list index.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be cleared.
+ */
+void clear_skip_list_index(SkipListIndex *skip_list_index)
+{
+  SkipListTower *current_tower = skip_list_index->lane_count == 0 ? NULL : skip_list_index->first_towers[0];
+
+  while (current_tower != NULL)
+  {
+    SkipListTower *next_tower = current_tower->next_towers[0];
+
+    free(current_tower);
+
+    current_tower = next_tower;
+  }
+
+  for (size_t lane_index = 0; lane_index < SKIP_LIST_INDEX_MAX_LANES; lane_index++)
+  {
+    skip_list_index->first_towers[lane_index] = NULL;
+  }
+
+  skip_list_index->lane_count = 0;
+}
+
+/**
+ * \brief Frees the skip list index and its towers. The indexed nodes are not touched.
+ *
+ * \param skip_list_index A pointer to the `SkipListIndex` to be freed.
+ */
+void free_skip_list_index(SkipListIndex *skip_list_index)
+{
+  clear_skip_list_index(skip_list_index);
+
+  free(skip_list_index);
+}
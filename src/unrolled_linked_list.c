@@ -0,0 +1,491 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/unrolled_linked_list.h"
+#include "../include/singly_linked_list_status.h"
+
+/**
+ * \brief Creates a new unrolled linked list with the provided function pointers.
+ *
+ * This function allocates memory for a new `UnrolledLinkedList` structure, initializes its fields,
+ * and sets the function pointers for printing, freeing, and comparing data. If any of the function
+ * pointers is NULL or the allocation fails, an error message is printed and the function returns `NULL`.
+ *
+ * \param print_data_function A function pointer used to print a piece of data.
+ * \param free_data_function A function pointer used to free a piece of data.
+ * \param compare_data_function A function pointer used to compare two pieces of data.
+ *
+ * \return A pointer to the newly created `UnrolledLinkedList` if successful, or `NULL` if an error occurs.
+ */
+UnrolledLinkedList *create_unrolled_linked_list(PrintDataFunction print_data_function, FreeDataFunction free_data_function, CompareDataFunction compare_data_function)
+{
+  if (print_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'print_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (free_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'free_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  if (compare_data_function == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_ARGUMENT, "'compare_data_function' cannot be NULL.");
+
+    return NULL;
+  }
+
+  UnrolledLinkedList *unrolled_linked_list = (UnrolledLinkedList *)malloc(sizeof(UnrolledLinkedList));
+
+  if (unrolled_linked_list == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'unrolled_linked_list'.");
+
+    return NULL;
+  }
+
+  unrolled_linked_list->head_node = NULL;
+  unrolled_linked_list->tail_node = NULL;
+  unrolled_linked_list->length = 0;
+  unrolled_linked_list->print_data_function = print_data_function;
+  unrolled_linked_list->free_data_function = free_data_function;
+  unrolled_linked_list->compare_data_function = compare_data_function;
+
+  return unrolled_linked_list;
+}
+
+/**
+ * \brief Creates a new empty block for an unrolled linked list.
+ *
+ * \return A pointer to the newly created `UnrolledNode` if successful, or `NULL` if the allocation fails.
+ */
+static UnrolledNode *create_unrolled_node(void)
+{
+  UnrolledNode *unrolled_node = (UnrolledNode *)aligned_alloc(_Alignof(UnrolledNode), sizeof(UnrolledNode));
+
+  if (unrolled_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_ALLOCATION_FAILED, "Memory allocation failed for 'unrolled_node'.");
+
+    return NULL;
+  }
+
+  unrolled_node->data_count = 0;
+  unrolled_node->next_node = NULL;
+
+  return unrolled_node;
+}
+
+/**
+ * \brief Inserts data at the head of the unrolled linked list.
+ *
+ * If the head block has a free slot, the data already stored in it is shifted by one slot and the new
+ * data is placed first. Otherwise a new block is allocated and becomes the head of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` where the data will be inserted.
+ * \param node_data The data to be inserted. This cannot be `NULL`.
+ */
+void insert_data_at_unrolled_linked_list_head(UnrolledLinkedList *unrolled_linked_list, NodeData node_data)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert data on a NULL unrolled linked list.");
+
+    return;
+  }
+
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert a NULL value.");
+
+    return;
+  }
+
+  UnrolledNode *head_node = unrolled_linked_list->head_node;
+
+  if (head_node == NULL || head_node->data_count == UNROLLED_NODE_CAPACITY)
+  {
+    UnrolledNode *new_node = create_unrolled_node();
+
+    if (new_node == NULL)
+    {
+      return;
+    }
+
+    new_node->next_node = head_node;
+    unrolled_linked_list->head_node = new_node;
+
+    if (unrolled_linked_list->tail_node == NULL)
+    {
+      unrolled_linked_list->tail_node = new_node;
+    }
+
+    head_node = new_node;
+  }
+
+  memmove(&head_node->node_data[1], &head_node->node_data[0], head_node->data_count * sizeof(NodeData));
+
+  head_node->node_data[0] = node_data;
+  head_node->data_count++;
+
+  unrolled_linked_list->length++;
+}
+
+/**
+ * \brief Inserts data at the tail of the unrolled linked list.
+ *
+ * If the tail block has a free slot, the data is appended to it. Otherwise a new block is allocated
+ * and becomes the tail of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` where the data will be inserted.
+ * \param node_data The data to be inserted. This cannot be `NULL`.
+ */
+void insert_data_at_unrolled_linked_list_tail(UnrolledLinkedList *unrolled_linked_list, NodeData node_data)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot insert data on a NULL unrolled linked list.");
+
+    return;
+  }
+
+  if (node_data == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_DATA, "You cannot insert a NULL value.");
+
+    return;
+  }
+
+  UnrolledNode *tail_node = unrolled_linked_list->tail_node;
+
+  if (tail_node == NULL || tail_node->data_count == UNROLLED_NODE_CAPACITY)
+  {
+    UnrolledNode *new_node = create_unrolled_node();
+
+    if (new_node == NULL)
+    {
+      return;
+    }
+
+    if (tail_node == NULL)
+    {
+      unrolled_linked_list->head_node = new_node;
+    }
+    else
+    {
+      tail_node->next_node = new_node;
+    }
+
+    unrolled_linked_list->tail_node = new_node;
+
+    tail_node = new_node;
+  }
+
+  tail_node->node_data[tail_node->data_count++] = node_data;
+
+  unrolled_linked_list->length++;
+}
+
+/**
+ * \brief Prints all the data in the unrolled linked list.
+ *
+ * This function iterates through every block starting from the head and prints each piece of data
+ * in order using the `print_data_function` provided during the creation of the list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` to be printed.
+ */
+void print_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot print a NULL unrolled linked list.");
+
+    return;
+  }
+
+  UnrolledNode *current_node = unrolled_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    for (size_t data_index = 0; data_index < current_node->data_count; data_index++)
+    {
+      unrolled_linked_list->print_data_function(current_node->node_data[data_index]);
+    }
+
+    current_node = current_node->next_node;
+  }
+}
+
+/**
+ * \brief Frees all the blocks in the unrolled linked list and releases the memory.
+ *
+ * This function frees every piece of data using the `free_data_function` provided during the creation
+ * of the list, then frees the blocks themselves. Afterward, the list is empty.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` to be freed.
+ */
+void free_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot free a NULL unrolled linked list.");
+
+    return;
+  }
+
+  UnrolledNode *current_node = unrolled_linked_list->head_node;
+  UnrolledNode *next_node = NULL;
+
+  while (current_node != NULL)
+  {
+    next_node = current_node->next_node;
+
+    for (size_t data_index = 0; data_index < current_node->data_count; data_index++)
+    {
+      unrolled_linked_list->free_data_function(current_node->node_data[data_index]);
+    }
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  unrolled_linked_list->head_node = NULL;
+  unrolled_linked_list->tail_node = NULL;
+  unrolled_linked_list->length = 0;
+}
+
+/**
+ * \brief Returns the number of elements in the unrolled linked list.
+ *
+ * \param unrolled_linked_list A pointer to the `UnrolledLinkedList` whose length is to be returned.
+ *
+ * \return The number of elements in the list, or 0 if the list is invalid.
+ */
+size_t get_unrolled_linked_list_length(UnrolledLinkedList *unrolled_linked_list)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    return 0;
+  }
+
+  return unrolled_linked_list->length;
+}
+
+/**
+ * \brief Reverses the order of elements in an unrolled linked list.
+ *
+ * This function reverses the order of the blocks and the order of the data inside every block,
+ * and swaps the head and tail blocks.
+ *
+ * \param unrolled_linked_list Pointer to the unrolled linked list to be reversed.
+ */
+void reverse_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot reverse a NULL unrolled linked list.");
+
+    return;
+  }
+
+  if (unrolled_linked_list->head_node == NULL)
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_EMPTY_LIST, "You cannot reverse an empty unrolled linked list.");
+
+    return;
+  }
+
+  UnrolledNode *previous_node = NULL;
+  UnrolledNode *current_node = unrolled_linked_list->head_node;
+  UnrolledNode *next_node = NULL;
+
+  while (current_node != NULL)
+  {
+    for (size_t low_index = 0, high_index = current_node->data_count - 1; low_index < high_index; low_index++, high_index--)
+    {
+      NodeData node_data = current_node->node_data[low_index];
+
+      current_node->node_data[low_index] = current_node->node_data[high_index];
+      current_node->node_data[high_index] = node_data;
+    }
+
+    next_node = current_node->next_node;
+    current_node->next_node = previous_node;
+    previous_node = current_node;
+    current_node = next_node;
+  }
+
+  unrolled_linked_list->tail_node = unrolled_linked_list->head_node;
+  unrolled_linked_list->head_node = previous_node;
+}
+
+/**
+ * \brief Searches for data in the unrolled linked list.
+ *
+ * This function compares every stored piece of data with the provided `node_data`, block by block,
+ * and returns the first one that matches.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list to search in.
+ * \param node_data The data to search for.
+ *
+ * \return The stored data that matches `node_data`, or `NULL` if there is no match.
+ */
+NodeData find_data_in_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list, NodeData node_data)
+{
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot search data on a NULL unrolled linked list.");
+
+    return NULL;
+  }
+
+  UnrolledNode *current_node = unrolled_linked_list->head_node;
+
+  while (current_node != NULL)
+  {
+    for (size_t data_index = 0; data_index < current_node->data_count; data_index++)
+    {
+      if (unrolled_linked_list->compare_data_function(current_node->node_data[data_index], node_data))
+      {
+        return current_node->node_data[data_index];
+      }
+    }
+
+    current_node = current_node->next_node;
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Checks if an unrolled linked list is valid.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list to be checked.
+ *
+ * \return true if the unrolled linked list is not NULL, false otherwise.
+ */
+bool is_valid_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list)
+{
+  return unrolled_linked_list != NULL;
+}
+
+/**
+ * \brief Deletes all the data in the unrolled linked list that matches the provided data.
+ *
+ * This function walks the list once, freeing every matching piece of data and packing the data that
+ * follows the first match towards the head, so that every block from the one holding the first match
+ * to the last one but one ends up full. Blocks left empty are freed and the tail pointer is adjusted.
+ * If nothing matches, the list is left untouched.
+ *
+ * \param unrolled_linked_list A pointer to the unrolled linked list from which data will be deleted.
+ * \param node_data The data to search for. Matching data will be deleted.
+ *
+ * \return The number of elements that were deleted from the list.
+ */
+size_t delete_data_from_unrolled_linked_list(UnrolledLinkedList *unrolled_linked_list, NodeData node_data)
+{
+  size_t deleted_data_count = 0;
+
+  if (!is_valid_unrolled_linked_list(unrolled_linked_list))
+  {
+    REPORT_SINGLY_LINKED_LIST_ERROR(SINGLY_LINKED_LIST_ERROR_NULL_LIST, "You cannot delete data on a NULL unrolled linked list.");
+
+    return deleted_data_count;
+  }
+
+  UnrolledNode *previous_read_node = NULL;
+  UnrolledNode *read_node = unrolled_linked_list->head_node;
+  UnrolledNode *write_node = NULL;
+  UnrolledNode *previous_write_node = NULL;
+  size_t write_index = 0;
+
+  while (read_node != NULL)
+  {
+    size_t read_count = read_node->data_count;
+    UnrolledNode *next_read_node = read_node->next_node;
+
+    for (size_t read_index = 0; read_index < read_count; read_index++)
+    {
+      NodeData current_data = read_node->node_data[read_index];
+
+      if (unrolled_linked_list->compare_data_function(current_data, node_data))
+      {
+        unrolled_linked_list->free_data_function(current_data);
+
+        /* Nothing is moved before the first match, so the packing starts at the slot it frees. */
+        if (deleted_data_count == 0)
+        {
+          write_node = read_node;
+          previous_write_node = previous_read_node;
+          write_index = read_index;
+        }
+
+        deleted_data_count++;
+
+        continue;
+      }
+
+      if (write_node == NULL)
+      {
+        continue;
+      }
+
+      write_node->node_data[write_index++] = current_data;
+
+      if (write_index == UNROLLED_NODE_CAPACITY)
+      {
+        write_node->data_count = write_index;
+        previous_write_node = write_node;
+        write_node = write_node->next_node;
+        write_index = 0;
+      }
+    }
+
+    previous_read_node = read_node;
+    read_node = next_read_node;
+  }
+
+  if (deleted_data_count == 0)
+  {
+    return deleted_data_count;
+  }
+
+  UnrolledNode *last_node = previous_write_node;
+  UnrolledNode *current_node = write_node;
+
+  if (write_node != NULL && write_index > 0)
+  {
+    write_node->data_count = write_index;
+    last_node = write_node;
+    current_node = write_node->next_node;
+  }
+
+  while (current_node != NULL)
+  {
+    UnrolledNode *next_node = current_node->next_node;
+
+    free(current_node);
+
+    current_node = next_node;
+  }
+
+  if (last_node == NULL)
+  {
+    unrolled_linked_list->head_node = NULL;
+  }
+  else
+  {
+    last_node->next_node = NULL;
+  }
+
+  unrolled_linked_list->tail_node = last_node;
+  unrolled_linked_list->length -= deleted_data_count;
+
+  return deleted_data_count;
+}